@@ -1493,3 +1493,320 @@ void MacroAssembler::generate_dsin_dcos(bool isCos, address npio2_hw,
     leave();
     ret(lr);
 }
+
+///* __kernel_tan( x, y, k )
+// * kernel tan function on [-pi/4, pi/4], pi/4 ~ 0.7854
+// * Input x is assumed to be bounded by ~pi/4 in magnitude.
+// * Input y is the tail of x.
+// * Input k indicates whether tan (if k=1) or
+// * -1/tan (if k= -1) is returned.
+// *
+// * Algorithm
+// *      1. Since tan(-x) = -tan(x), we need only to consider positive x.
+// *      2. if x < 2^-28 (hx<0x3e300000 0), return x with inexact if x!=0.
+// *      3. tan(x) is approximated by a odd polynomial of degree 27 on
+// *         [0,0.67434]
+// *                               3             27
+// *              tan(x) ~ x + T1*x + ... + T13*x
+// *         where
+// *
+// *              |tan(x)         2     4            26   |     -59.2
+// *              |----- - (1+T1*x +T2*x +.... +T13*x    )| <= 2
+// *              |  x                                    |
+// *
+// *         Note: tan(x+y) = tan(x) + tan'(x)*y
+// *                        ~ tan(x) + (1+x*x)*y
+// *         Therefore, for better accuracy in computing tan(x+y), let
+// *                   3      2      2       2       2
+// *              r = x *(T2+x *(T3+x *(...+x *(T12+x *T13))))
+// *         then
+// *                                  3    2
+// *              tan(x+y) = x + (T1*x + (x *(r+y)+y))
+// *
+// *      4. For x in [0.67434,pi/4],  let y = pi/4 - x, then
+// *              tan(x) = tan(pi/4-y) = (1-tan(y))/(1+tan(y))
+// *                     = 1 - 2*(tan(y) - (tan(y)^2)/(1+tan(y)))
+// */
+//
+// NOTE: T[0]..T[12], pio4 and pio4lo were moved into a table:
+// StubRoutines::aarch64::_dtan_coef
+//
+// BEGIN __kernel_tan PSEUDO CODE
+//
+//static double __kernel_tan(double x, double y, int iy)
+//{
+//  double z,r,v,w,s;
+//  int ix,hx;
+//  hx = high(x);           /* high word of x */
+//  ix = hx&0x7fffffff;     /* high word of |x| */
+//  if(ix<0x3e300000) {                     /* x < 2**-28 */
+//    if((int)x==0) {                       /* generate inexact */
+//      // NOTE: removed. x == 0 && iy == -1 is impossible for a reduced
+//      // argument of a finite double, because pi/2 is irrational
+//      //if (((ix | low(x)) | (iy + 1)) == 0)
+//      //  return one / fabsd(x);
+//      //else {
+//        if (iy == 1)
+//          return x;
+//        else {    /* compute -1 / (x+y) carefully */
+//          // NOTE: same code as at the end of this function with r == y
+//          ...
+//        }
+//      //}
+//    }
+//  }
+//  if(ix>=0x3FE59428) {                    /* |x|>=0.6744 */
+//    if(hx<0) {x = -x; y = -y;}
+//    z = pio4-x;
+//    w = pio4lo-y;
+//    x = z+w; y = 0.0;
+//  }
+//  z       =  x*x;
+//  w       =  z*z;
+//  r = T[1]+w*(T[3]+w*(T[5]+w*(T[7]+w*(T[9]+w*T[11]))));
+//  v = z*(T[2]+w*(T[4]+w*(T[6]+w*(T[8]+w*(T[10]+w*T[12])))));
+//  s = z*x;
+//  r = y + z*(s*(r+v)+y);
+//  r += T[0]*s;
+//  w = x+r;
+//  if(ix>=0x3FE59428) {
+//    v = (double)iy;
+//    return (double)(1-((hx>>30)&2))*(v-2.0*(x-(w*w/(w+v)-r)));
+//  }
+//  if(iy==1) return w;
+//  else {
+//    /*  compute -1.0/(x+r) accurately */
+//    double a,t;
+//    z  = w;
+//    set_low(&z, 0);
+//    v  = r-(z - x);     /* z+v = r+x */
+//    t = a  = -1.0/w;    /* a = -1.0/w */
+//    set_low(&t, 0);
+//    s  = 1.0+t*z;
+//    return t+a*(s+t*v);
+//  }
+//}
+//
+// END __kernel_tan PSEUDO CODE
+//
+// Changes between fdlibm and intrinsic:
+//     1. Constants are now loaded from table dtan_coef
+//     2. C code parameter "int iy" was modified to "bool iyIsOne", because
+//         iy is always 1 or -1. The iy checks were moved into generation
+//         phase instead of taking them during code execution
+//     3. Removed x == 0 && iy == -1 check (see NOTE in pseudo code)
+//     4. Polynomials are evaluated with fused multiply-add
+// Input and output:
+//     1. Input for generated function: X argument = x, tail of X = v5
+//     2. Input for generator: x = register to read argument from, iyIsOne
+//         = generate tan(x) or -1/tan(x), dtan_coef = coefficients table address
+//     3. Return tan(x) or -1/tan(x) value in v0
+void MacroAssembler::generate_kernel_tan(FloatRegister x, bool iyIsOne,
+    address dtan_coef) {
+  Register hx = r4, ix = r5;
+  FloatRegister two = v1, y = v5, z = v6, w = v7, r = v16, v = v17, s = v18,
+      t = v19, a = v20, one = v21, P0 = v22, P1 = v23, P2 = v24, P3 = v25,
+      P4 = v26, P5 = v27, P6 = v28, P7 = v29, P8 = v30, P9 = v31;
+  Label TINY_X, X_IS_SMALL, X_IS_POSITIVE, X_IS_LARGE, RECIPROCAL, DONE;
+    lea(rscratch2, ExternalAddress(dtan_coef));
+    fmovd(hx, x);
+    lsr(hx, hx, 32);                                 // hx = high(x)
+    andw(ix, hx, 0x7fffffff);                        // ix = high(|x|)
+    mov(rscratch1, 0x3e300000);
+    cmpw(ix, rscratch1);
+    br(LT, TINY_X);
+    mov(rscratch1, 0x3FE59428);
+    cmpw(ix, rscratch1);
+    br(LT, X_IS_SMALL);
+    block_comment("if(ix>=0x3FE59428) {x = pio4-x; ...}"); {
+      ldpd(a, t, Address(rscratch2, 13 * wordSize)); // load pio4, pio4lo
+      tbz(hx, 31, X_IS_POSITIVE);
+      fnegd(x, x);
+      fnegd(y, y);
+    bind(X_IS_POSITIVE);
+      fsubd(z, a, x);                                // z = pio4-x
+      fsubd(w, t, y);                                // w = pio4lo-y
+      faddd(x, z, w);                                // x = z+w
+      eor(y, T8B, y, y);                             // y = 0.0
+    }
+  bind(X_IS_SMALL);
+    ldpd(P8, P9, Address(rscratch2, 11 * wordSize)); // load T[11], T[12]
+    fmuld(z, x, x);                                  // z = x*x
+    ldpd(P6, P7, Address(rscratch2, 9 * wordSize));  // load T[9], T[10]
+    fmuld(w, z, z);                                  // w = z*z
+    ldpd(P4, P5, Address(rscratch2, 7 * wordSize));  // load T[7], T[8]
+    ldpd(P2, P3, Address(rscratch2, 5 * wordSize));  // load T[5], T[6]
+    ldpd(P0, P1, Address(rscratch2, 3 * wordSize));  // load T[3], T[4]
+    block_comment("calculate r = T[1]+w*(T[3]+w*(T[5]+w*(T[7]+w*(T[9]+w*T[11])))) "
+                  "and v = z*(T[2]+w*(T[4]+w*(T[6]+w*(T[8]+w*(T[10]+w*T[12])))))"); {
+      // r and v chains are independent: interleave them to utilize 2nd FPU
+      fmaddd(r, w, P8, P6);
+      fmaddd(v, w, P9, P7);
+      ldpd(P6, P7, Address(rscratch2, 1 * wordSize)); // load T[1], T[2]
+      fmaddd(r, w, r, P4);
+      fmaddd(v, w, v, P5);
+      ldrd(P8, Address(rscratch2));                   // load T[0]
+      fmaddd(r, w, r, P2);
+      fmaddd(v, w, v, P3);
+      fmaddd(r, w, r, P0);
+      fmaddd(v, w, v, P1);
+      fmaddd(r, w, r, P6);
+      fmaddd(v, w, v, P7);
+      fmuld(v, z, v);
+    }
+    block_comment("r = y + z*(s*(r+v)+y); r += T[0]*s; w = x+r;"); {
+      fmuld(s, z, x);                                 // s = z*x
+      faddd(r, r, v);                                 // r+v
+      fmaddd(r, s, r, y);                             // s*(r+v)+y
+      fmaddd(r, z, r, y);                             // y + z*(s*(r+v)+y)
+      fmaddd(r, P8, s, r);                            // r += T[0]*s
+      faddd(w, x, r);                                 // w = x+r
+    }
+    mov(rscratch1, 0x3FE59428);
+    cmpw(ix, rscratch1);
+    br(GE, X_IS_LARGE);
+    if (iyIsOne) {
+      block_comment("if(iy==1) return w;"); {
+        fmovd(v0, w);
+        b(DONE);
+      }
+    } else {
+      b(RECIPROCAL);
+    }
+  block_comment("if(ix>=0x3FE59428) {...}"); {
+    bind(X_IS_LARGE);
+      // return (double)(1-((hx>>30)&2))*(v-2.0*(x-(w*w/(w+v)-r)));
+      fmovd(v, iyIsOne ? 1.0 : -1.0);                 // v = (double)iy
+      faddd(a, w, v);                                 // w+v
+      fmuld(t, w, w);                                 // w*w
+      fmovd(two, 2.0);
+      fdivd(t, t, a);                                 // w*w/(w+v)
+      fsubd(t, t, r);                                 // w*w/(w+v)-r
+      fsubd(t, x, t);                                 // x-(w*w/(w+v)-r)
+      fmsubd(v0, two, t, v);                          // v-2.0*(x-(w*w/(w+v)-r))
+      tbz(hx, 31, DONE);
+      fnegd(v0, v0);
+      b(DONE);
+  }
+  block_comment("if(ix<0x3e300000) {<fast return>}"); {
+    bind(TINY_X);
+      if (iyIsOne) {
+        fmovd(v0, x);
+        b(DONE);
+      } else {
+        // compute -1 / (x+y) carefully: the same as -1.0/(x+r) with r == y
+        faddd(w, x, y);                               // z = w = x + y
+        fmovd(r, y);
+      }
+  }
+  if (!iyIsOne) {
+    block_comment("compute -1.0/(x+r) accurately"); {
+      bind(RECIPROCAL);
+        fmovd(rscratch1, w);
+        fmovd(a, -1.0);
+        andr(rscratch1, rscratch1, 0xFFFFFFFF00000000);
+        fdivd(a, a, w);                               // t = a = -1.0/w
+        fmovd(z, rscratch1);                          // z = w; set_low(&z, 0);
+        fsubd(v, z, x);
+        fmovd(one, 1.0);
+        fsubd(v, r, v);                               // v = r-(z - x)
+        fmovd(rscratch1, a);
+        andr(rscratch1, rscratch1, 0xFFFFFFFF00000000);
+        fmovd(t, rscratch1);                          // set_low(&t, 0);
+        fmaddd(s, t, z, one);                         // s = 1.0+t*z
+        fmaddd(s, t, v, s);                           // s+t*v
+        fmaddd(v0, a, s, t);                          // t+a*(s+t*v)
+    }
+  }
+  bind(DONE);
+}
+
+// generate_dtan creates stub for dtan. It works as follows:
+// 1) handle corner cases: |x| ~< pi/4, x is NaN or INF
+// 2) perform argument reduction if required
+// 3) call kernel_tan which approximates tan or -1/tan via polynomial
+//
+// BEGIN dtan PSEUDO CODE
+//
+//dtan(jdouble x) {
+//  double y[2],z=0.0;
+//  int n, ix;
+//
+//  /* High word of x. */
+//  ix = high(x);
+//
+//  /* |x| ~< pi/4 */
+//  ix &= 0x7fffffff;
+//  if(ix <= 0x3fe921fb) return __kernel_tan(x,z,1);
+//
+//  /* tan(Inf or NaN) is NaN */
+//  else if (ix>=0x7ff00000) return x-x;            /* NaN */
+//
+//  /* argument reduction needed */
+//  else {
+//    n = __ieee754_rem_pio2(x,y);
+//    return __kernel_tan(y[0],y[1],1-((n&1)<<1)); /*   1 -- n even
+//                                                     -1 -- n odd */
+//  }
+//}
+// END dtan PSEUDO CODE
+//
+// Changes between fdlibm and intrinsic:
+//     1. n&1 check is done via tbnz and selects one of two kernel_tan
+//         versions generated with fixed iy
+// Input and output:
+//     1. Input for generated function: X = r0
+//     2. Input for generator: npio2_hw = address of npio2_hw table,
+//         two_over_pi = address of two_over_pi table, pio2 = address if pio2
+//         table, dtan_coef = address of dtan_coef table
+//     3. Return result in v0
+// NOTE: general purpose register names match local variable names in C code
+void MacroAssembler::generate_dtan(address npio2_hw, address two_over_pi,
+    address pio2, address dtan_coef) {
+  const int POSITIVE_INFINITY_OR_NAN_PREFIX = 0x7FF0;
+
+  Label DONE, ARG_REDUCTION, N_IS_ODD, EARLY_CASE;
+  Register X = r0, absX = r1, n = r2, ix = r3;
+  FloatRegister y0 = v4, y1 = v5;
+
+  enter();
+  // r19 is used in TemplateInterpreterGenerator::generate_math_entry
+  RegSet saved_regs = RegSet::of(r19);
+  push (saved_regs, sp);
+
+    block_comment("check |x| ~< pi/4, NaN and Inf cases"); {
+      fmovd(X, v0);
+      mov(rscratch1, 0x3fe921fb00000000);            // pi/4. shifted to reuse later
+      ubfm(absX, X, 0, 62);                          // absX
+      movz(r10, POSITIVE_INFINITY_OR_NAN_PREFIX, 48);
+      lsr(ix, absX, 32);                             // set ix
+      cmp(ix, rscratch1, LSR, 32);
+      br(LE, EARLY_CASE);                            // if(ix <= 0x3fe921fb) return
+      cmp(absX, r10);
+      br(LT, ARG_REDUCTION);
+      // X is NaN or INF(i.e. 0x7FF* or 0xFFF*). Return NaN (mantissa != 0).
+      // Set last bit unconditionally to make it NaN
+      orr(r10, r10, 1);
+      fmovd(v0, r10);
+      b(DONE);
+    }
+  bind(ARG_REDUCTION); /* argument reduction needed */
+    block_comment("n = __ieee754_rem_pio2(x,y);"); {
+      generate__ieee754_rem_pio2(npio2_hw, two_over_pi, pio2);
+    }
+    block_comment("return __kernel_tan(y[0],y[1],1-((n&1)<<1));"); {
+      tbnz(n, 0, N_IS_ODD);
+      generate_kernel_tan(y0, true, dtan_coef);
+      b(DONE);
+    bind(N_IS_ODD);
+      generate_kernel_tan(y0, false, dtan_coef);
+      b(DONE);
+    }
+  bind(EARLY_CASE);
+    eor(y1, T8B, y1, y1);
+    generate_kernel_tan(v0, true, dtan_coef);
+  bind(DONE);
+    pop(saved_regs, sp);
+    leave();
+    ret(lr);
+}
@@ -4644,6 +4644,17 @@ class StubGenerator: public StubCodeGenerator {
     return start;
   }
 
+  address generate_dtan() {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "libmDtan");
+    address start = __ pc();
+    __ generate_dtan((address)StubRoutines::aarch64::_npio2_hw,
+        (address)StubRoutines::aarch64::_two_over_pi,
+        (address)StubRoutines::aarch64::_pio2,
+        (address)StubRoutines::aarch64::_dtan_coef);
+    return start;
+  }
+
   address generate_dlog() {
     __ align(CodeEntryAlignment);
     StubCodeMark mark(this, "StubRoutines", "dlog");
@@ -7022,6 +7033,10 @@ class StubGenerator: public StubCodeGenerator {
       StubRoutines::_dcos = generate_dsin_dcos(/* isCos = */ true);
     }
 
+    if (vmIntrinsics::is_intrinsic_available(vmIntrinsics::_dtan)) {
+      StubRoutines::_dtan = generate_dtan();
+    }
+
     // Safefetch stubs.
     generate_safefetch("SafeFetch32", sizeof(int),     &StubRoutines::_safefetch32_entry,
                                                        &StubRoutines::_safefetch32_fault_pc,
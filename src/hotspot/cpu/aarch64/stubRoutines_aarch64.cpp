@@ -345,6 +345,27 @@ ATTRIBUTE_ALIGNED(64) jdouble StubRoutines::aarch64::_dcos_coef[] = {
     -1.13596475577881948265e-11  // 0xBDA8FAE9BE8838D4
 };
 
+// Coefficients for tan(x) polynomial approximation: T[0]..T[12], followed by
+// pio4 and pio4lo. See kernel_tan comments in macroAssembler_aarch64_trig.cpp
+// for details
+ATTRIBUTE_ALIGNED(64) jdouble StubRoutines::aarch64::_dtan_coef[] = {
+     3.33333333333334091986e-01, // 0x3FD5555555555563
+     1.33333333333201242699e-01, // 0x3FC111111110FE7A
+     5.39682539762260521377e-02, // 0x3FABA1BA1BB341FE
+     2.18694882948595424599e-02, // 0x3F9664F48406D637
+     8.86323982359930005737e-03, // 0x3F8226E3E96E8493
+     3.59207910759131235356e-03, // 0x3F6D6D22C9560328
+     1.45620945432529025516e-03, // 0x3F57DBC8FEE08315
+     5.88041240820264096874e-04, // 0x3F4344D8F2F26501
+     2.46463134818469906812e-04, // 0x3F3026F71A8D1068
+     7.81794442939557092300e-05, // 0x3F147E88A03792A6
+     7.14072491382608190305e-05, // 0x3F12B80F32F0A7E9
+    -1.85586374855275456654e-05, // 0xBEF375CBDB605373
+     2.59073051863633712884e-05, // 0x3EFB2A7074BF7AD4
+     7.85398163397448278999e-01, // 0x3FE921FB54442D18 pio4
+     3.06161699786838301793e-17  // 0x3C81A62633145C07 pio4lo
+};
+
 // Table of constants for 2/pi, 396 Hex digits (476 decimal) of 2/pi.
 // Used in cases of very large argument. 396 hex digits is enough to support
 // required precision.
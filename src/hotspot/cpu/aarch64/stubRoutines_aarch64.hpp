@@ -35,7 +35,7 @@ static bool    returns_to_call_stub(address return_pc)   {
 }
 
 enum platform_dependent_constants {
-  code_size1 = 19000,          // simply increase if too small (assembler will crash if too small)
+  code_size1 = 23000,          // simply increase if too small (assembler will crash if too small)
   code_size2 = 28000           // simply increase if too small (assembler will crash if too small)
 };
 
@@ -194,6 +194,7 @@ private:
   static jdouble   _pio2[];
   static jdouble   _dsin_coef[];
   static jdouble  _dcos_coef[];
+  static jdouble  _dtan_coef[];
   // end trigonometric tables block
 };
 
@@ -1511,6 +1511,9 @@ private:
 
   // Move Unaligned 256bit Vector
   void vmovdqu(Address dst, XMMRegister src);
+
+  // Move Aligned Vector Non-Temporal (AVX: 16, 32; EVEX: 64 bytes)
+  void vmovntdq(Address dst, XMMRegister src, int vector_len);
   void vmovdqu(XMMRegister dst, Address src);
   void vmovdqu(XMMRegister dst, XMMRegister src);
 
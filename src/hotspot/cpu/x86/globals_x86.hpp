@@ -215,6 +215,15 @@ define_pd_global(intx, InitArrayShortSize, 8*BytesPerLong);
              range(0, max_jint)                                             \
              constraint(AVX3ThresholdConstraintFunc,AfterErgo)              \
                                                                             \
+  /* Fills that do not fit in the last level cache only evict useful */    \
+  /* data, so write them around the cache. */                              \
+  product(intx, NonTemporalFillThreshold, 0, DIAGNOSTIC,                    \
+             "Minimum array size in bytes to use non-temporal stores in "   \
+             "the fill stubs. Zero disables non-temporal stores. Derived "  \
+             "from the last level cache size by default. The fill stubs "   \
+             "are only used with OptimizeFill, which is off by default.")   \
+             range(0, max_jint)                                             \
+                                                                            \
   product(bool, IntelJccErratumMitigation, true, DIAGNOSTIC,                \
              "Turn off JVM mitigations related to Intel micro code "        \
              "mitigations for the Intel JCC erratum")
@@ -5495,6 +5495,47 @@ void MacroAssembler::generate_fill(BasicType t, bool aligned,
       movdl(xtmp, value);
       if (UseAVX >= 2 && UseUnalignedLoadStores) {
         Label L_check_fill_32_bytes;
+        if (NonTemporalFillThreshold > 0) {
+          // Fill 64-byte chunks with non-temporal stores
+          Label L_fill_64_bytes_loop_nt, L_check_fill_nt;
+          // at least the unaligned head plus one loop iteration
+          intx nt_bytes = MAX2(NonTemporalFillThreshold, (intx)256);
+          int nt_count = (int)(nt_bytes >> (2 - shift));
+
+          // If number of elements to fill < threshold, fill through the cache
+          cmpl(count, nt_count);
+          jcc(Assembler::below, L_check_fill_nt);
+
+          vpbroadcastd(xtmp, xtmp, Assembler::AVX_256bit);
+
+          // vmovntdq needs a 32-byte aligned destination: store the first
+          // 32 bytes unaligned and continue from the next aligned address.
+          // 'to' is element aligned, so rtmp is a whole number of elements.
+          vmovdqu(Address(to, 0), xtmp);
+          movptr(rtmp, to);
+          negptr(rtmp);
+          andptr(rtmp, 31);
+          addptr(to, rtmp);
+          if (shift < 2) {
+            shrl(rtmp, 2 - shift);
+          }
+          subl(count, rtmp);
+
+          subl(count, 16 << shift);
+          align(16);
+
+          BIND(L_fill_64_bytes_loop_nt);
+          vmovntdq(Address(to, 0), xtmp, Assembler::AVX_256bit);
+          vmovntdq(Address(to, 32), xtmp, Assembler::AVX_256bit);
+          addptr(to, 64);
+          subl(count, 16 << shift);
+          jcc(Assembler::greaterEqual, L_fill_64_bytes_loop_nt);
+          // order the weakly-ordered stores before any following store
+          sfence();
+          jmp(L_check_fill_32_bytes);
+
+          BIND(L_check_fill_nt);
+        }
         if (UseAVX > 2) {
           // Fill 64-byte chunks
           Label L_fill_64_bytes_loop_avx3, L_check_fill_64_bytes_avx2;
@@ -82,7 +82,8 @@ class VM_Version_StubGenerator: public StubCodeGenerator {
     bool use_evex = FLAG_IS_DEFAULT(UseAVX) || (UseAVX > 2);
 
     Label detect_486, cpu486, detect_586, std_cpuid1, std_cpuid4;
-    Label sef_cpuid, ext_cpuid, ext_cpuid1, ext_cpuid5, ext_cpuid7, ext_cpuid8, done, wrapup;
+    Label std_cpuid4_llc_loop, std_cpuid4_llc_skip, std_cpuid4_llc_next;
+    Label sef_cpuid, ext_cpuid, ext_cpuid1, ext_cpuid5, ext_cpuid6, ext_cpuid7, ext_cpuid8, done, wrapup;
     Label legacy_setup, save_restore_except, legacy_save_restore, start_simd_check;
 
     StubCodeMark mark(this, "VM_Version", "get_cpu_info_stub");
@@ -227,6 +228,47 @@ class VM_Version_StubGenerator: public StubCodeGenerator {
     __ movl(Address(rsi, 8), rcx);
     __ movl(Address(rsi,12), rdx);
 
+    // Last level cache: walk the cpuid(0x4) subleaves until an invalid one
+    // and record the data or unified cache with the highest cache level,
+    // which is reported in eax[7:5].
+    __ movl(Address(rbp, in_bytes(VM_Version::dcp_cpuid4_llc_offset())), 0);
+    __ xorl(rsi, rsi);   // subleaf index
+
+    __ bind(std_cpuid4_llc_loop);
+    __ movl(rax, 4);
+    __ movl(rcx, rsi);
+    __ cpuid();
+    __ testl(rax, 0x1f); // eax[4:0] == 0 indicates no more caches
+    __ jcc(Assembler::zero, std_cpuid1);
+
+    __ push(rdx);
+    __ movl(rdx, rax);
+    __ andl(rdx, 0x1f);
+    __ cmpl(rdx, 2);     // Skip instruction caches
+    __ jccb(Assembler::equal, std_cpuid4_llc_skip);
+    __ movl(rdx, Address(rbp, in_bytes(VM_Version::dcp_cpuid4_llc_offset())));
+    __ andl(rdx, 0xe0);  // Level of the recorded cache
+    __ push(rax);
+    __ andl(rax, 0xe0);  // Level of this cache
+    __ cmpl(rax, rdx);
+    __ pop(rax);
+    __ jccb(Assembler::belowEqual, std_cpuid4_llc_skip);
+    __ pop(rdx);
+
+    __ movl(Address(rbp, in_bytes(VM_Version::dcp_cpuid4_llc_offset()) + 0), rax);
+    __ movl(Address(rbp, in_bytes(VM_Version::dcp_cpuid4_llc_offset()) + 4), rbx);
+    __ movl(Address(rbp, in_bytes(VM_Version::dcp_cpuid4_llc_offset()) + 8), rcx);
+    __ movl(Address(rbp, in_bytes(VM_Version::dcp_cpuid4_llc_offset()) + 12), rdx);
+    __ jmpb(std_cpuid4_llc_next);
+
+    __ bind(std_cpuid4_llc_skip);
+    __ pop(rdx);
+
+    __ bind(std_cpuid4_llc_next);
+    __ incrementl(rsi);
+    __ cmpl(rsi, 16);    // Don't trust cpuid to ever report an invalid subleaf
+    __ jcc(Assembler::below, std_cpuid4_llc_loop);
+
     //
     // Standard cpuid(0x1)
     //
@@ -282,8 +324,10 @@ class VM_Version_StubGenerator: public StubCodeGenerator {
     __ jcc(Assembler::belowEqual, done);
     __ cmpl(rax, 0x80000004);     // Is cpuid(0x80000005) supported?
     __ jcc(Assembler::belowEqual, ext_cpuid1);
+    __ cmpl(rax, 0x80000005);     // Is cpuid(0x80000006) supported?
+    __ jcc(Assembler::belowEqual, ext_cpuid5);
     __ cmpl(rax, 0x80000006);     // Is cpuid(0x80000007) supported?
-    __ jccb(Assembler::belowEqual, ext_cpuid5);
+    __ jcc(Assembler::belowEqual, ext_cpuid6);
     __ cmpl(rax, 0x80000007);     // Is cpuid(0x80000008) supported?
     __ jccb(Assembler::belowEqual, ext_cpuid7);
     __ cmpl(rax, 0x80000008);     // Is cpuid(0x80000009 and above) supported?
@@ -325,6 +369,18 @@ class VM_Version_StubGenerator: public StubCodeGenerator {
     __ movl(Address(rsi, 8), rcx);
     __ movl(Address(rsi,12), rdx);
 
+    //
+    // Extended cpuid(0x80000006)
+    //
+    __ bind(ext_cpuid6);
+    __ movl(rax, 0x80000006);
+    __ cpuid();
+    __ lea(rsi, Address(rbp, in_bytes(VM_Version::ext_cpuid6_offset())));
+    __ movl(Address(rsi, 0), rax);
+    __ movl(Address(rsi, 4), rbx);
+    __ movl(Address(rsi, 8), rcx);
+    __ movl(Address(rsi,12), rdx);
+
     //
     // Extended cpuid(0x80000005)
     //
@@ -1470,6 +1526,15 @@ void VM_Version::get_processor_features() {
   }
 #endif // _LP64
 
+  if (FLAG_IS_DEFAULT(NonTemporalFillThreshold)) {
+    // Same heuristic as glibc memset: fills larger than 3/4 of the
+    // last level cache bypass it.
+    size_t llc_size = last_level_cache_size();
+    if (llc_size > 0) {
+      FLAG_SET_DEFAULT(NonTemporalFillThreshold, (intx)MIN2(llc_size / 4 * 3, (size_t)max_jint));
+    }
+  }
+
   // Use count leading zeros count instruction if available.
   if (supports_lzcnt()) {
     if (FLAG_IS_DEFAULT(UseCountLeadingZerosInstruction)) {
@@ -1570,7 +1635,9 @@ void VM_Version::get_processor_features() {
   if (FLAG_IS_DEFAULT(OptimizeFill)) {
     // 8247307: On x86, the auto-vectorized loop array fill code shows
     // better performance than the array fill stubs. We should reenable
-    // this after the x86 stubs get improved.
+    // this after the x86 stubs get improved. Note that the non-temporal
+    // stores for large fills (NonTemporalFillThreshold) are only in the
+    // stubs, and so are only used with -XX:+OptimizeFill.
     OptimizeFill = false;
   }
 #endif // COMPILER2
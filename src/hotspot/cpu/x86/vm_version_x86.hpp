@@ -120,7 +120,8 @@ class VM_Version : public Abstract_VM_Version {
     uint32_t value;
     struct {
       uint32_t cache_type    : 5,
-                             : 21,
+               cache_level   : 3,
+                             : 18,
                cores_per_cpu : 6;
     } bits;
   };
@@ -416,6 +417,12 @@ enum Extended_Family {
     uint32_t     dcp_cpuid4_ecx; // unused currently
     uint32_t     dcp_cpuid4_edx; // unused currently
 
+    // cpuid function 4 for the data or unified cache with the highest level
+    DcpCpuid4Eax dcp_cpuid4_llc_eax;
+    DcpCpuid4Ebx dcp_cpuid4_llc_ebx;
+    uint32_t     dcp_cpuid4_llc_ecx; // number of sets - 1
+    uint32_t     dcp_cpuid4_llc_edx; // unused currently
+
     // cpuid function 7 (structured extended features)
     SefCpuid7Eax sef_cpuid7_eax;
     SefCpuid7Ebx sef_cpuid7_ebx;
@@ -464,6 +471,12 @@ enum Extended_Family {
     ExtCpuid5Ex  ext_cpuid5_ecx; // L1 data cache info (AMD)
     ExtCpuid5Ex  ext_cpuid5_edx; // L1 instruction cache info (AMD)
 
+    // cpuid function 0x80000006 // AMD L2 and L3, Intel L2
+    uint32_t     ext_cpuid6_eax; // reserved
+    uint32_t     ext_cpuid6_ebx; // reserved
+    uint32_t     ext_cpuid6_ecx; // L2 cache info, size in KB in bits 31:16
+    uint32_t     ext_cpuid6_edx; // L3 cache info (AMD), size in 512KB units in bits 31:18
+
     // cpuid function 0x80000007
     uint32_t     ext_cpuid7_eax; // reserved
     uint32_t     ext_cpuid7_ebx; // reserved
@@ -714,9 +727,11 @@ public:
   static ByteSize std_cpuid0_offset() { return byte_offset_of(CpuidInfo, std_max_function); }
   static ByteSize std_cpuid1_offset() { return byte_offset_of(CpuidInfo, std_cpuid1_eax); }
   static ByteSize dcp_cpuid4_offset() { return byte_offset_of(CpuidInfo, dcp_cpuid4_eax); }
+  static ByteSize dcp_cpuid4_llc_offset() { return byte_offset_of(CpuidInfo, dcp_cpuid4_llc_eax); }
   static ByteSize sef_cpuid7_offset() { return byte_offset_of(CpuidInfo, sef_cpuid7_eax); }
   static ByteSize ext_cpuid1_offset() { return byte_offset_of(CpuidInfo, ext_cpuid1_eax); }
   static ByteSize ext_cpuid5_offset() { return byte_offset_of(CpuidInfo, ext_cpuid5_eax); }
+  static ByteSize ext_cpuid6_offset() { return byte_offset_of(CpuidInfo, ext_cpuid6_eax); }
   static ByteSize ext_cpuid7_offset() { return byte_offset_of(CpuidInfo, ext_cpuid7_eax); }
   static ByteSize ext_cpuid8_offset() { return byte_offset_of(CpuidInfo, ext_cpuid8_eax); }
   static ByteSize ext_cpuid1E_offset() { return byte_offset_of(CpuidInfo, ext_cpuid1E_eax); }
@@ -848,6 +863,27 @@ public:
     return L1_line_size();
   }
 
+  // Size in bytes of the last level cache reported by cpuid(0x4), or by
+  // cpuid(0x80000006) on AMD, or 0 if it is not known.
+  static size_t last_level_cache_size() {
+    if (is_amd_family()) {
+      size_t l3_size = (size_t)(_cpuid_info.ext_cpuid6_edx >> 18) * 512 * K;
+      size_t l2_size = (size_t)(_cpuid_info.ext_cpuid6_ecx >> 16) * K;
+      return l3_size > 0 ? l3_size : l2_size;
+    }
+    if (!is_intel() && !is_zx()) {
+      return 0;
+    }
+    if (_cpuid_info.dcp_cpuid4_llc_eax.bits.cache_type == 0) {
+      return 0;
+    }
+    size_t ways       = _cpuid_info.dcp_cpuid4_llc_ebx.bits.associativity + 1;
+    size_t partitions = _cpuid_info.dcp_cpuid4_llc_ebx.bits.partitions + 1;
+    size_t line_size  = _cpuid_info.dcp_cpuid4_llc_ebx.bits.L1_line_size + 1;
+    size_t sets       = (size_t)_cpuid_info.dcp_cpuid4_llc_ecx + 1;
+    return ways * partitions * line_size * sets;
+  }
+
   //
   // Feature identification
   //
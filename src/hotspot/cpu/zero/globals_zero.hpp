@@ -83,7 +83,10 @@ define_pd_global(bool, CompactStrings, false);
           "Use fast method entry code for empty methods")                   \
                                                                             \
   product(bool, UseFastAccessorMethods, true,                               \
-          "Use fast method entry code for accessor methods")
+          "Use fast method entry code for accessor methods")                \
+                                                                            \
+  product(bool, UseFastMathMethods, true,                                   \
+          "Use fast method entry code for intrinsic java.lang.Math methods")
 
 // end of ARCH_FLAGS
 
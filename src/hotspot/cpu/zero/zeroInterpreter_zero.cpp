@@ -36,11 +36,13 @@
 #include "oops/methodData.hpp"
 #include "oops/method.hpp"
 #include "oops/oop.inline.hpp"
+#include "oops/typeArrayOop.inline.hpp"
 #include "prims/jvmtiExport.hpp"
 #include "runtime/frame.inline.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/jniHandles.inline.hpp"
+#include "runtime/sharedRuntime.hpp"
 #include "runtime/timer.hpp"
 #include "runtime/timerTrace.hpp"
 #include "utilities/debug.hpp"
@@ -143,6 +145,177 @@ int ZeroInterpreter::Reference_get_entry(Method* method, intptr_t UNUSED, TRAPS)
   return 0;
 }
 
+int ZeroInterpreter::math_entry(Method* method, intptr_t UNUSED, TRAPS) {
+  JavaThread* thread = THREAD;
+  ZeroStack* stack = thread->zero_stack();
+
+  // Drop into the slow path if we need a safepoint check
+  if (SafepointMechanism::should_process(thread)) {
+    return normal_entry(method, 0, THREAD);
+  }
+
+  // The parameters are addressed the same way as the locals
+  // of the frame the slow path would have built
+  intptr_t* locals = stack->sp() + (method->size_of_parameters() - 1);
+  intptr_t* topOfStack;
+
+  if (method->intrinsic_id() == vmIntrinsics::_fmaF) {
+    jfloat result = fmaf(LOCALS_FLOAT(0), LOCALS_FLOAT(1), LOCALS_FLOAT(2));
+
+    // Pop our parameters and push our result
+    stack->set_sp(stack->sp() + method->size_of_parameters() - 1);
+    topOfStack = stack->sp();
+    SET_STACK_FLOAT(result, 0);
+    return 0;
+  }
+
+  jdouble result;
+  switch (method->intrinsic_id()) {
+    case vmIntrinsics::_dsin:   result = SharedRuntime::dsin(LOCALS_DOUBLE(0));   break;
+    case vmIntrinsics::_dcos:   result = SharedRuntime::dcos(LOCALS_DOUBLE(0));   break;
+    case vmIntrinsics::_dtan:   result = SharedRuntime::dtan(LOCALS_DOUBLE(0));   break;
+    case vmIntrinsics::_dlog:   result = SharedRuntime::dlog(LOCALS_DOUBLE(0));   break;
+    case vmIntrinsics::_dlog10: result = SharedRuntime::dlog10(LOCALS_DOUBLE(0)); break;
+    case vmIntrinsics::_dexp:   result = SharedRuntime::dexp(LOCALS_DOUBLE(0));   break;
+    case vmIntrinsics::_dabs:   result = fabs(LOCALS_DOUBLE(0));                  break;
+    case vmIntrinsics::_dsqrt:  result = sqrt(LOCALS_DOUBLE(0));                  break;
+    case vmIntrinsics::_dpow:
+      result = SharedRuntime::dpow(LOCALS_DOUBLE(0), LOCALS_DOUBLE(2));
+      break;
+    case vmIntrinsics::_fmaD:
+      result = fma(LOCALS_DOUBLE(0), LOCALS_DOUBLE(2), LOCALS_DOUBLE(4));
+      break;
+    default:
+      ShouldNotReachHere();
+      result = 0.0;
+  }
+
+  // Pop our parameters and push our result
+  stack->set_sp(stack->sp() + method->size_of_parameters() - 2);
+  topOfStack = stack->sp();
+  SET_STACK_DOUBLE(result, 0);
+
+  // No deoptimized frames on the stack
+  return 0;
+}
+
+juint ZeroInterpreter::_crc32_table[8][256];
+
+void ZeroInterpreter::generate_crc32_table() {
+  // Byte-at-a-time table for the reflected polynomial, as in zlib
+  for (juint n = 0; n < 256; n++) {
+    juint c = n;
+    for (int k = 0; k < 8; k++) {
+      c = (c & 1) ? (0xedb88320 ^ (c >> 1)) : (c >> 1);
+    }
+    _crc32_table[0][n] = c;
+  }
+
+  // Table k advances the CRC of a byte over k further zero bytes
+  for (juint n = 0; n < 256; n++) {
+    juint c = _crc32_table[0][n];
+    for (int k = 1; k < 8; k++) {
+      c = _crc32_table[0][c & 0xff] ^ (c >> 8);
+      _crc32_table[k][n] = c;
+    }
+  }
+}
+
+juint ZeroInterpreter::update_crc32(juint crc, const jubyte* buf, int len) {
+  crc = ~crc;
+
+  // Consume eight bytes per step.  The input is assembled byte by
+  // byte, so this needs neither alignment nor a particular endianness.
+  while (len >= 8) {
+    juint lo = crc ^ ((juint) buf[0]         | ((juint) buf[1] << 8) |
+                      ((juint) buf[2] << 16) | ((juint) buf[3] << 24));
+    crc = _crc32_table[7][lo & 0xff]         ^ _crc32_table[6][(lo >> 8) & 0xff] ^
+          _crc32_table[5][(lo >> 16) & 0xff] ^ _crc32_table[4][lo >> 24]         ^
+          _crc32_table[3][buf[4]]            ^ _crc32_table[2][buf[5]]           ^
+          _crc32_table[1][buf[6]]            ^ _crc32_table[0][buf[7]];
+    buf += 8;
+    len -= 8;
+  }
+  while (len-- > 0) {
+    crc = _crc32_table[0][(crc ^ *buf++) & 0xff] ^ (crc >> 8);
+  }
+
+  return ~crc;
+}
+
+int ZeroInterpreter::CRC32_update_entry(Method* method, intptr_t UNUSED, TRAPS) {
+  JavaThread* thread = THREAD;
+  ZeroStack* stack = thread->zero_stack();
+
+  // Drop into the slow path if we need a safepoint check
+  if (SafepointMechanism::should_process(thread)) {
+    return native_entry(method, 0, THREAD);
+  }
+
+  // CRC32.update(int crc, int b)
+  intptr_t* locals = stack->sp() + (method->size_of_parameters() - 1);
+  jubyte b = (jubyte) LOCALS_INT(1);
+  jint crc = (jint) update_crc32((juint) LOCALS_INT(0), &b, 1);
+
+  // Pop our parameters and push our result
+  stack->set_sp(stack->sp() + method->size_of_parameters() - 1);
+  intptr_t* topOfStack = stack->sp();
+  SET_STACK_INT(crc, 0);
+
+  // No deoptimized frames on the stack
+  return 0;
+}
+
+int ZeroInterpreter::CRC32_updateBytes_entry(Method* method, intptr_t UNUSED, TRAPS) {
+  JavaThread* thread = THREAD;
+  ZeroStack* stack = thread->zero_stack();
+
+  // Drop into the slow path if we need a safepoint check
+  if (SafepointMechanism::should_process(thread)) {
+    return native_entry(method, 0, THREAD);
+  }
+
+  // CRC32.updateBytes0(int crc, byte[] b, int off, int len)
+  //
+  // The Java caller has already range checked off and len.  Nothing
+  // here can safepoint, so the array cannot move while it is read.
+  intptr_t* locals = stack->sp() + (method->size_of_parameters() - 1);
+  typeArrayOop array = (typeArrayOop) LOCALS_OBJECT(1);
+  const jubyte* buf = (const jubyte*) array->base(T_BYTE) + LOCALS_INT(2);
+  jint crc = (jint) update_crc32((juint) LOCALS_INT(0), buf, LOCALS_INT(3));
+
+  // Pop our parameters and push our result
+  stack->set_sp(stack->sp() + method->size_of_parameters() - 1);
+  intptr_t* topOfStack = stack->sp();
+  SET_STACK_INT(crc, 0);
+
+  // No deoptimized frames on the stack
+  return 0;
+}
+
+int ZeroInterpreter::CRC32_updateByteBuffer_entry(Method* method, intptr_t UNUSED, TRAPS) {
+  JavaThread* thread = THREAD;
+  ZeroStack* stack = thread->zero_stack();
+
+  // Drop into the slow path if we need a safepoint check
+  if (SafepointMechanism::should_process(thread)) {
+    return native_entry(method, 0, THREAD);
+  }
+
+  // CRC32.updateByteBuffer0(int crc, long addr, int off, int len)
+  intptr_t* locals = stack->sp() + (method->size_of_parameters() - 1);
+  const jubyte* buf = (const jubyte*) (intptr_t) LOCALS_LONG(1) + LOCALS_INT(3);
+  jint crc = (jint) update_crc32((juint) LOCALS_INT(0), buf, LOCALS_INT(4));
+
+  // Pop our parameters and push our result
+  stack->set_sp(stack->sp() + method->size_of_parameters() - 1);
+  intptr_t* topOfStack = stack->sp();
+  SET_STACK_INT(crc, 0);
+
+  // No deoptimized frames on the stack
+  return 0;
+}
+
 intptr_t narrow(BasicType type, intptr_t result) {
   // mask integer result to narrower return type.
   switch (type) {
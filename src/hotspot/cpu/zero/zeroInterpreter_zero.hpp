@@ -38,6 +38,19 @@
   static int setter_entry(Method* method, intptr_t UNUSED, TRAPS);
   static int empty_entry(Method* method, intptr_t UNUSED, TRAPS);
   static int Reference_get_entry(Method* method, intptr_t UNUSED, TRAPS);
+  static int math_entry(Method* method, intptr_t UNUSED, TRAPS);
+  static int CRC32_update_entry(Method* method, intptr_t UNUSED, TRAPS);
+  static int CRC32_updateBytes_entry(Method* method, intptr_t UNUSED, TRAPS);
+  static int CRC32_updateByteBuffer_entry(Method* method, intptr_t UNUSED, TRAPS);
+
+ private:
+  // Slicing-by-8 tables for the portable CRC32 entries
+  static juint _crc32_table[8][256];
+
+  static juint update_crc32(juint crc, const jubyte* buf, int len);
+
+ public:
+  static void generate_crc32_table();
 
  public:
   // Main loop of normal_entry
@@ -441,7 +441,7 @@ void Compilation::compile_method() {
     return;
   }
 
-  if (_env->jvmti_can_hotswap_or_post_breakpoint()) {
+  if (_env->should_record_evol_dependencies()) {
     // We can assert evol_method because method->can_be_compiled is true.
     dependency_recorder()->assert_evol_method(method());
   }
@@ -348,6 +348,9 @@ public:
     return _jvmti_can_access_local_variables || _jvmti_can_pop_frame;
   }
   bool  jvmti_can_hotswap_or_post_breakpoint() const { return _jvmti_can_hotswap_or_post_breakpoint; }
+  bool  should_record_evol_dependencies() const {
+    return AlwaysRecordEvolDependencies || _jvmti_can_hotswap_or_post_breakpoint;
+  }
   bool  jvmti_can_post_on_exceptions()         const { return _jvmti_can_post_on_exceptions; }
   bool  jvmti_can_get_owned_monitor_info()     const { return _jvmti_can_get_owned_monitor_info; }
   bool  jvmti_can_walk_any_space()             const { return _jvmti_can_walk_any_space; }
@@ -91,6 +91,18 @@ bool G1Allocator::is_retained_old_region(HeapRegion* hr) {
   return _retained_old_gc_alloc_region == hr;
 }
 
+void G1Allocator::offer_retained_old_region(HeapRegion* hr) {
+  assert_heap_locked_or_at_safepoint(true /* should_be_vm_thread */);
+  assert(hr->is_old(), "Retained region %u must be old", hr->hrm_index());
+
+  // The current retained region may have been freed and reused since the
+  // last collection, so only keep it if it is still an old region.
+  HeapRegion* retained = _retained_old_gc_alloc_region;
+  if (retained == NULL || !retained->is_old() || retained->free() < hr->free()) {
+    _retained_old_gc_alloc_region = hr;
+  }
+}
+
 void G1Allocator::reuse_retained_old_region(G1EvacuationInfo& evacuation_info,
                                             OldGCAllocRegion* old,
                                             HeapRegion** retained_old) {
@@ -264,7 +276,7 @@ HeapWord* G1Allocator::survivor_attempt_allocation(size_t min_word_size,
 HeapWord* G1Allocator::old_attempt_allocation(size_t min_word_size,
                                               size_t desired_word_size,
                                               size_t* actual_word_size) {
-  assert(!_g1h->is_humongous(desired_word_size),
+  assert(!_g1h->is_humongous(desired_word_size) || _g1h->is_old_region_object(desired_word_size),
          "we should not be seeing humongous-size allocations in this path");
 
   HeapWord* result = old_gc_alloc_region()->attempt_allocation(min_word_size,
@@ -109,6 +109,9 @@ public:
   void release_gc_alloc_regions(G1EvacuationInfo& evacuation_info);
   void abandon_gc_alloc_regions();
   bool is_retained_old_region(HeapRegion* hr);
+  // Make the given old region the retained old GC alloc region if it has
+  // more space left than the current one.
+  void offer_retained_old_region(HeapRegion* hr);
 
   // Allocate blocks of memory during mutator time.
 
@@ -249,6 +249,13 @@ size_t G1Analytics::predict_scan_card_num(size_t rs_length, bool for_young_gc) c
   }
 }
 
+bool G1Analytics::enough_young_card_cost_samples_available() const {
+  // Unlike the scan cost, the merge cost does not start out with a default
+  // value, so its samples are all measured. A pause that logged cards both
+  // merges and scans them.
+  return enough_samples_available(_young_cost_per_card_merge_ms_seq);
+}
+
 double G1Analytics::predict_card_merge_time_ms(size_t card_num, bool for_young_gc) const {
   if (for_young_gc || !enough_samples_available(_mixed_cost_per_card_merge_ms_seq)) {
     return card_num * predict_zero_bounded(_young_cost_per_card_merge_ms_seq);
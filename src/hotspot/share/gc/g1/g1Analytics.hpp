@@ -145,6 +145,10 @@ public:
 
   size_t predict_scan_card_num(size_t rs_length, bool for_young_gc) const;
 
+  // Returns whether the young card merge and scan costs have been measured
+  // often enough to predict from them.
+  bool enough_young_card_cost_samples_available() const;
+
   double predict_card_merge_time_ms(size_t card_num, bool for_young_gc) const;
   double predict_card_scan_time_ms(size_t card_num, bool for_young_gc) const;
 
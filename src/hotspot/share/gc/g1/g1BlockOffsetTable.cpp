@@ -425,6 +425,31 @@ HeapWord* G1BlockOffsetTablePart::initialize_threshold() {
   return _next_offset_threshold;
 }
 
+void G1BlockOffsetTablePart::update_for_block(HeapWord* blk_start, HeapWord* blk_end) {
+  // The first entry boundary at or above blk_start.
+  size_t index = _bot->index_for(blk_start);
+  HeapWord* threshold = _bot->address_for_index_raw(index);
+  if (threshold < blk_start) {
+    index++;
+    threshold += BOTConstants::N_words;
+  }
+  if (blk_end > threshold) {
+    alloc_block_work(&threshold, &index, blk_start, blk_end);
+  }
+}
+
+void G1BlockOffsetTablePart::set_threshold_after(HeapWord* blk_end) {
+  if (blk_end == _hr->bottom()) {
+    initialize_threshold();
+    return;
+  }
+  size_t end_index = _bot->index_for(blk_end - 1);
+  _next_offset_index = end_index + 1;
+  // Calculate the threshold this way because end_index
+  // may be the last valid index in the covered region.
+  _next_offset_threshold = _bot->address_for_index(end_index) + BOTConstants::N_words;
+}
+
 void G1BlockOffsetTablePart::set_for_starts_humongous(HeapWord* obj_top, size_t fill_size) {
   // The first BOT entry should have offset 0.
   reset_bot();
@@ -225,6 +225,17 @@ public:
     alloc_block(blk, blk+size);
   }
 
+  // Record the block [blk_start, blk_end) in the table without using or
+  // updating "_next_offset_threshold". Every entry is owned by the single
+  // block covering its card boundary, so disjoint blocks of the same region
+  // may be recorded by different threads at the same time.
+  void update_for_block(HeapWord* blk_start, HeapWord* blk_end);
+
+  // Set "_next_offset_threshold" to the first boundary after "blk_end", as
+  // if the blocks up to "blk_end" had been recorded with alloc_block().
+  // Used once all of them have been recorded with update_for_block().
+  void set_threshold_after(HeapWord* blk_end);
+
   void set_for_starts_humongous(HeapWord* obj_top, size_t fill_size);
   void set_object_can_span(bool can_span) NOT_DEBUG_RETURN;
 
@@ -47,7 +47,6 @@
 #include "gc/g1/g1HeapSizingPolicy.hpp"
 #include "gc/g1/g1HeapTransition.hpp"
 #include "gc/g1/g1HeapVerifier.hpp"
-#include "gc/g1/g1HotCardCache.hpp"
 #include "gc/g1/g1InitLogger.hpp"
 #include "gc/g1/g1MemoryPool.hpp"
 #include "gc/g1/g1OopClosures.inline.hpp"
@@ -113,6 +112,7 @@
 #include "utilities/stack.inline.hpp"
 
 size_t G1CollectedHeap::_humongous_object_threshold_in_words = 0;
+size_t G1CollectedHeap::_old_region_object_threshold_in_words = 0;
 
 // INVARIANTS/NOTES
 //
@@ -354,6 +354,47 @@ HeapWord* G1CollectedHeap::humongous_obj_allocate(size_t word_size) {
   return result;
 }
 
+HeapWord* G1CollectedHeap::old_region_obj_allocate(size_t word_size) {
+  assert_heap_locked_or_at_safepoint(true /* should_be_vm_thread */);
+  assert(is_old_region_object(word_size), "Object of size " SIZE_FORMAT " must not be placed into an old region", word_size);
+
+  // Only use free regions: other old regions may be concurrently refined,
+  // which requires their top to be stable.
+  HeapRegion* hr = new_region(word_size, HeapRegionType::Old, false /* do_expand */);
+  if (hr == NULL) {
+    return NULL;
+  }
+
+  hr->set_old();
+  _verifier->check_bitmaps("Old Region Object Allocation", hr);
+  _policy->remset_tracker()->update_at_allocate(hr);
+  _hr_printer.alloc(hr);
+
+  assert(hr->top() == hr->bottom(), "region %u must be empty", hr->hrm_index());
+  HeapWord* result = hr->bottom();
+  HeapWord* obj_top = result + word_size;
+
+  // Concurrent refinement may process a stale card of this old region as
+  // soon as top covers the object. As for humongous objects, zero the
+  // header first so that refinement sees a NULL klass and bails out until
+  // the allocating thread has installed the header, and set up the BOT
+  // before top is published.
+  Copy::fill_to_words(result, oopDesc::header_size(), 0);
+  hr->update_bot_for_block(result, obj_top);
+  OrderAccess::storestore();
+  hr->set_top(obj_top);
+  hr->update_bot_threshold_to_top();
+  increase_used(word_size * HeapWordSize);
+  old_set_add(hr);
+
+  // Let the next collection promote objects into the rest of the region
+  // instead of leaving it unused like the tail of a humongous region.
+  _allocator->offer_retained_old_region(hr);
+
+  g1mm()->update_sizes();
+  return result;
+}
+
 HeapWord* G1CollectedHeap::allocate_new_tlab(size_t min_size,
                                              size_t requested_size,
                                              size_t* actual_size) {
@@ -849,6 +890,13 @@ HeapWord* G1CollectedHeap::attempt_allocation_humongous(size_t word_size) {
       // Given that humongous objects are not allocated in young
       // regions, we'll first try to do the allocation without doing a
       // collection hoping that there's enough space in the heap.
+      if (is_old_region_object(word_size)) {
+        result = old_region_obj_allocate(word_size);
+        if (result != NULL) {
+          policy()->old_gen_alloc_tracker()->add_allocated_bytes_since_last_gc(word_size * HeapWordSize);
+          return result;
+        }
+      }
       result = humongous_obj_allocate(word_size);
       if (result != NULL) {
         size_t size_in_regions = humongous_obj_size_in_regions(word_size);
@@ -873,9 +921,11 @@ HeapWord* G1CollectedHeap::attempt_allocation_humongous(size_t word_size) {
         assert(succeeded, "only way to get back a non-NULL result");
         log_trace(gc, alloc)("%s: Successfully scheduled collection returning " PTR_FORMAT,
                              Thread::current()->name(), p2i(result));
-        size_t size_in_regions = humongous_obj_size_in_regions(word_size);
-        policy()->old_gen_alloc_tracker()->
-          record_collection_pause_humongous_allocation(size_in_regions * HeapRegion::GrainBytes);
+        if (heap_region_containing(result)->is_humongous()) {
+          size_t size_in_regions = humongous_obj_size_in_regions(word_size);
+          policy()->old_gen_alloc_tracker()->
+            record_collection_pause_humongous_allocation(size_in_regions * HeapRegion::GrainBytes);
+        }
         return result;
       }
 
@@ -933,7 +983,13 @@ HeapWord* G1CollectedHeap::attempt_allocation_at_safepoint(size_t word_size,
   if (!is_humongous(word_size)) {
     return _allocator->attempt_allocation_locked(word_size);
   } else {
-    HeapWord* result = humongous_obj_allocate(word_size);
+    HeapWord* result = NULL;
+    if (is_old_region_object(word_size)) {
+      result = old_region_obj_allocate(word_size);
+    }
+    if (result == NULL) {
+      result = humongous_obj_allocate(word_size);
+    }
     if (result != NULL && policy()->need_to_start_conc_mark("STW humongous allocation")) {
       collector_state()->set_initiate_conc_mark_if_possible(true);
     }
@@ -1034,10 +1090,6 @@ void G1CollectedHeap::prepare_heap_for_mutators() {
 }
 
 void G1CollectedHeap::abort_refinement() {
-  if (_hot_card_cache->use_cache()) {
-    _hot_card_cache->reset_hot_cache();
-  }
-
   // Discard all remembered set updates and reset refinement statistics.
   G1BarrierSet::dirty_card_queue_set().abandon_logs();
   assert(G1BarrierSet::dirty_card_queue_set().num_cards() == 0,
@@ -1431,13 +1483,13 @@ G1CollectedHeap::G1CollectedHeap() :
   _policy(new G1Policy(_gc_timer_stw)),
   _heap_sizing_policy(NULL),
   _collection_set(this, _policy),
-  _hot_card_cache(NULL),
   _rem_set(NULL),
   _cm(NULL),
   _cm_thread(NULL),
   _cr(NULL),
   _task_queues(NULL),
   _num_regions_failed_evacuation(0),
+  _regions_failed_evacuation(NULL),
   _evacuation_failed_info_array(NULL),
   _preserved_marks_set(true /* in_c_heap */),
 #ifndef PRODUCT
@@ -1460,6 +1512,8 @@ G1CollectedHeap::G1CollectedHeap() :
   _heap_sizing_policy = G1HeapSizingPolicy::create(this, _policy->analytics());
 
   _humongous_object_threshold_in_words = humongous_threshold_for(HeapRegion::GrainWords);
+  _old_region_object_threshold_in_words = MAX2(_humongous_object_threshold_in_words,
+                                                HeapRegion::GrainWords * G1OldRegionObjectMaxPercent / 100);
 
   // Override the default _filler_array_max_size so that no humongous filler
   // objects are created.
@@ -1578,9 +1632,6 @@ jint G1CollectedHeap::initialize() {
     satbqs.set_buffer_enqueue_threshold_percentage(G1SATBBufferEnqueueingThresholdPercent);
   }
 
-  // Create the hot card cache.
-  _hot_card_cache = new G1HotCardCache(this);
-
   // Create space mappers.
   size_t page_size = heap_rs.page_size();
   G1RegionToSpaceMapper* heap_storage =
@@ -1603,7 +1654,7 @@ jint G1CollectedHeap::initialize() {
                        heap_rs.size());
   heap_storage->set_mapping_changed_listener(&_listener);
 
-  // Create storage for the BOT, card table, card counts table (hot card cache) and the bitmaps.
+  // Create storage for the BOT, card table and the bitmaps.
   G1RegionToSpaceMapper* bot_storage =
     create_aux_memory_mapper("Block Offset Table",
                              G1BlockOffsetTable::compute_size(heap_rs.size() / HeapWordSize),
@@ -1614,23 +1665,15 @@ jint G1CollectedHeap::initialize() {
                              G1CardTable::compute_size(heap_rs.size() / HeapWordSize),
                              G1CardTable::heap_map_factor());
 
-  G1RegionToSpaceMapper* card_counts_storage =
-    create_aux_memory_mapper("Card Counts Table",
-                             G1CardCounts::compute_size(heap_rs.size() / HeapWordSize),
-                             G1CardCounts::heap_map_factor());
-
   size_t bitmap_size = G1CMBitMap::compute_size(heap_rs.size());
   G1RegionToSpaceMapper* prev_bitmap_storage =
     create_aux_memory_mapper("Prev Bitmap", bitmap_size, G1CMBitMap::heap_map_factor());
   G1RegionToSpaceMapper* next_bitmap_storage =
     create_aux_memory_mapper("Next Bitmap", bitmap_size, G1CMBitMap::heap_map_factor());
 
-  _hrm.initialize(heap_storage, prev_bitmap_storage, next_bitmap_storage, bot_storage, cardtable_storage, card_counts_storage);
+  _hrm.initialize(heap_storage, prev_bitmap_storage, next_bitmap_storage, bot_storage, cardtable_storage);
   _card_table->initialize(cardtable_storage);
 
-  // Do later initialization work for concurrent refinement.
-  _hot_card_cache->initialize(card_counts_storage);
-
   // 6843694 - ensure that the maximum region index can fit
   // in the remembered set structures.
   const uint max_region_idx = (1U << (sizeof(RegionIdx_t)*BitsPerByte-1)) - 1;
@@ -1641,9 +1684,11 @@ jint G1CollectedHeap::initialize() {
   guarantee(heap_rs.base() >= (char*)G1CardTable::card_size, "Java heap must not start within the first card.");
   G1FromCardCache::initialize(max_reserved_regions());
   // Also create a G1 rem set.
-  _rem_set = new G1RemSet(this, _card_table, _hot_card_cache);
+  _rem_set = new G1RemSet(this, _card_table);
   _rem_set->initialize(max_reserved_regions());
 
+  _regions_failed_evacuation = NEW_C_HEAP_ARRAY(uint, max_reserved_regions(), mtGC);
+
   size_t max_cards_per_region = ((size_t)1 << (sizeof(CardIdx_t)*BitsPerByte-1)) - 1;
   guarantee(HeapRegion::CardsPerRegion > 0, "make sure it's initialized");
   guarantee(HeapRegion::CardsPerRegion < max_cards_per_region,
@@ -1826,10 +1871,6 @@ size_t G1CollectedHeap::unused_committed_regions_in_bytes() const {
   return _hrm.total_free_bytes();
 }
 
-void G1CollectedHeap::iterate_hcc_closure(G1CardTableEntryClosure* cl, uint worker_id) {
-  _hot_card_cache->drain(cl, worker_id);
-}
-
 // Computes the sum of the storage used by the various regions.
 size_t G1CollectedHeap::used() const {
   size_t result = _summary_bytes_used + _allocator->used_in_alloc_regions();
@@ -3439,10 +3480,6 @@ void G1CollectedHeap::pre_evacuate_collection_set(G1EvacuationInfo& evacuation_i
   _expand_heap_after_alloc_failure = true;
   Atomic::store(&_num_regions_failed_evacuation, 0u);
 
-  // Disable the hot card cache.
-  _hot_card_cache->reset_hot_cache_claimed_index();
-  _hot_card_cache->set_use_cache(false);
-
   // Initialize the GC alloc regions.
   _allocator->init_gc_alloc_regions(evacuation_info);
 
@@ -3750,13 +3787,6 @@ void G1CollectedHeap::free_region(HeapRegion* hr, FreeRegionList* free_list) {
     concurrent_mark()->clear_range_in_prev_bitmap(mr);
   }
 
-  // Clear the card counts for this region.
-  // Note: we only need to do this if the region is not young
-  // (since we don't refine cards in young regions).
-  if (!hr->is_young()) {
-    _hot_card_cache->reset_card_counts(hr);
-  }
-
   // Reset region metadata to allow reuse.
   hr->hr_clear(true /* clear_space */);
   _policy->remset_tracker()->update_at_free(hr);
@@ -4212,11 +4242,6 @@ void G1CollectedHeap::update_used_after_gc() {
   }
 }
 
-void G1CollectedHeap::reset_hot_card_cache() {
-  _hot_card_cache->reset_hot_cache();
-  _hot_card_cache->set_use_cache(true);
-}
-
 void G1CollectedHeap::purge_code_root_memory() {
   G1CodeRootSet::purge();
 }
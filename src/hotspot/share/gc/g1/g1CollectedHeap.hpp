@@ -75,10 +75,8 @@ class SpaceClosure;
 class CompactibleSpaceClosure;
 class Space;
 class G1BatchedGangTask;
-class G1CardTableEntryClosure;
 class G1CollectionSet;
 class G1Policy;
-class G1HotCardCache;
 class G1RemSet;
 class G1ServiceTask;
 class G1ServiceThread;
@@ -166,6 +164,7 @@ private:
   SoftRefPolicy      _soft_ref_policy;
 
   static size_t _humongous_object_threshold_in_words;
+  static size_t _old_region_object_threshold_in_words;
 
   // These sets keep track of old, archive and humongous regions respectively.
   HeapRegionSet _old_set;
@@ -429,6 +428,11 @@ private:
   // NULL if unsuccessful.
   HeapWord* humongous_obj_allocate(size_t word_size);
 
+  // Attempt to allocate an object of the given humongous size into a new
+  // old region, which is then offered to the next collection for promotion.
+  // Return NULL if unsuccessful.
+  HeapWord* old_region_obj_allocate(size_t word_size);
+
   // The following two methods, allocate_new_tlab() and
   // mem_allocate(), are the two main entry points from the runtime
   // into the G1's allocation routines. They have the following
@@ -834,9 +838,6 @@ public:
   // Update object copying statistics.
   void record_obj_copy_mem_stats();
 
-  // The hot card cache for remembered set insertion optimization.
-  G1HotCardCache* _hot_card_cache;
-
   // The g1 remembered set of the heap.
   G1RemSet* _rem_set;
 
@@ -867,6 +868,8 @@ public:
 
   // Number of regions evacuation failed in the current collection.
   volatile uint _num_regions_failed_evacuation;
+  // Indices of the regions that failed evacuation in the current collection.
+  uint* _regions_failed_evacuation;
 
   EvacuationFailedInfo* _evacuation_failed_info_array;
 
@@ -1051,9 +1054,6 @@ public:
   // Try to minimize the remembered set.
   void scrub_rem_set();
 
-  // Apply the given closure on all cards in the Hot Card Cache, emptying it.
-  void iterate_hcc_closure(G1CardTableEntryClosure* cl, uint worker_id);
-
   // The shared block offset table array.
   G1BlockOffsetTable* bot() const { return _bot; }
 
@@ -1145,9 +1145,11 @@ public:
   // True iff an evacuation has failed in the most-recent collection.
   inline bool evacuation_failed() const;
   inline uint num_regions_failed_evacuation() const;
+  // Returns the i-th region that failed evacuation in the current collection.
+  inline HeapRegion* region_failed_evacuation(uint i) const;
   // Notify that the garbage collection encountered an evacuation failure in a
   // region. Should only be called once per region.
-  inline void notify_region_failed_evacuation();
+  inline void notify_region_failed_evacuation(uint region_idx);
 
   void remove_from_old_gen_sets(const uint old_regions_removed,
                                 const uint archive_regions_removed,
@@ -1184,8 +1186,6 @@ public:
     return reserved().contains(addr);
   }
 
-  G1HotCardCache* hot_card_cache() const { return _hot_card_cache; }
-
   G1CardTable* card_table() const {
     return _card_table;
   }
@@ -1300,6 +1300,12 @@ public:
     return word_size > _humongous_object_threshold_in_words;
   }
 
+  // Returns "true" iff an object of the given humongous word_size is
+  // allocated into an old region instead of its own humongous region.
+  static bool is_old_region_object(size_t word_size) {
+    return is_humongous(word_size) && word_size <= _old_region_object_threshold_in_words;
+  }
+
   // Returns the humongous threshold for a specific region size
   static size_t humongous_threshold_for(size_t region_size) {
     return (region_size / 2);
@@ -1394,10 +1400,6 @@ public:
   // Recalculate amount of used memory after GC. Must be called after all allocation
   // has finished.
   void update_used_after_gc();
-  // Reset and re-enable the hot card cache.
-  // Note the counts for the cards in the regions in the
-  // collection set are reset when the collection set is freed.
-  void reset_hot_card_cache();
   // Free up superfluous code root memory.
   void purge_code_root_memory();
 
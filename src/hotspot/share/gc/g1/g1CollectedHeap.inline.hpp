@@ -198,8 +198,14 @@ uint G1CollectedHeap::num_regions_failed_evacuation() const {
   return Atomic::load(&_num_regions_failed_evacuation);
 }
 
-void G1CollectedHeap::notify_region_failed_evacuation() {
-  Atomic::inc(&_num_regions_failed_evacuation, memory_order_relaxed);
+HeapRegion* G1CollectedHeap::region_failed_evacuation(uint i) const {
+  assert(i < num_regions_failed_evacuation(), "index %u out of bounds", i);
+  return region_at(_regions_failed_evacuation[i]);
+}
+
+void G1CollectedHeap::notify_region_failed_evacuation(uint region_idx) {
+  uint i = Atomic::fetch_and_add(&_num_regions_failed_evacuation, 1u, memory_order_relaxed);
+  _regions_failed_evacuation[i] = region_idx;
 }
 
 #ifndef PRODUCT
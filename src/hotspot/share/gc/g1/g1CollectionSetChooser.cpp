@@ -295,17 +295,23 @@ void G1CollectionSetChooser::prune(G1CollectionSetCandidates* candidates) {
   uint num_candidates = candidates->num_regions();
 
   if (min_old_cset_length < num_candidates) {
+    // Regions left out of the remembered set rebuild at Remark already used
+    // up part of the allowed waste.
+    size_t const excluded = p->remset_tracker()->rebuild_excluded_reclaimable_bytes();
     size_t allowed_waste = p->allowed_waste_in_collection_set();
+    allowed_waste -= MIN2(excluded, allowed_waste);
 
     G1PruneRegionClosure prune_cl(num_candidates - min_old_cset_length,
                                   allowed_waste);
     candidates->iterate_backwards(&prune_cl);
 
-    log_debug(gc, ergo, cset)("Pruned %u regions out of %u, leaving " SIZE_FORMAT " bytes waste (allowed " SIZE_FORMAT ")",
+    log_debug(gc, ergo, cset)("Pruned %u regions out of %u, leaving " SIZE_FORMAT " bytes waste (allowed " SIZE_FORMAT
+                              ", " SIZE_FORMAT " excluded from rebuild)",
                               prune_cl.num_pruned(),
                               candidates->num_regions(),
                               prune_cl.wasted(),
-                              allowed_waste);
+                              allowed_waste,
+                              excluded);
 
     candidates->remove_from_end(prune_cl.num_pruned(), prune_cl.wasted());
   }
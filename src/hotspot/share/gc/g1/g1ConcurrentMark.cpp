@@ -1144,6 +1144,8 @@ void G1ConcurrentMark::remark() {
                                        G1UpdateRemSetTrackingBeforeRebuildTask::RegionsPerThread;
       uint const num_workers = MIN2(_g1h->workers()->active_workers(), workers_by_capacity);
 
+      _g1h->policy()->remset_tracker()->calc_rebuild_live_threshold();
+
       G1UpdateRemSetTrackingBeforeRebuildTask cl(_g1h, this, num_workers);
       log_debug(gc,ergo)("Running %s using %u workers for %u regions in heap", cl.name(), num_workers, _g1h->num_regions());
       _g1h->workers()->run_task(&cl, num_workers);
@@ -324,10 +324,25 @@ uint G1ConcurrentRefine::max_num_threads() {
 static size_t calc_new_green_zone(size_t green,
                                   double logged_cards_scan_time,
                                   size_t processed_logged_cards,
+                                  double predicted_card_time_ms,
                                   double goal_ms) {
-  // Adjust green zone based on whether we're meeting the time goal.
-  // Limit to max_green_zone.
   const double inc_k = 1.1, dec_k = 0.9;
+  if (predicted_card_time_ms > 0.0) {
+    // Leave as many cards for the pause as the policy predicts can be
+    // processed within the time goal; the activation thresholds of the
+    // refinement threads, and so their number, follow from that.
+    double predicted_green = goal_ms / predicted_card_time_ms;
+    size_t new_green = static_cast<size_t>(MIN2(predicted_green, static_cast<double>(max_green_zone)));
+    if (logged_cards_scan_time > goal_ms) {
+      // The last pause missed the goal, so the prediction was too low, e.g.
+      // because the cost per card has just risen. Shrink the zone at least
+      // as fast as without a prediction until the samples catch up.
+      new_green = MIN2(new_green, static_cast<size_t>(green * dec_k));
+    }
+    return new_green;
+  }
+  // Not enough samples for a prediction yet. Adjust green zone based on
+  // whether we're meeting the time goal. Limit to max_green_zone.
   if (logged_cards_scan_time > goal_ms) {
     if (green > 0) {
       green = static_cast<size_t>(green * dec_k);
@@ -352,18 +367,22 @@ static size_t calc_new_red_zone(size_t green, size_t yellow) {
 
 void G1ConcurrentRefine::update_zones(double logged_cards_scan_time,
                                       size_t processed_logged_cards,
+                                      double predicted_card_time_ms,
                                       double goal_ms) {
   log_trace( CTRL_TAGS )("Updating Refinement Zones: "
                          "logged cards scan time: %.3fms, "
                          "processed cards: " SIZE_FORMAT ", "
+                         "predicted card time: %.6fms, "
                          "goal time: %.3fms",
                          logged_cards_scan_time,
                          processed_logged_cards,
+                         predicted_card_time_ms,
                          goal_ms);
 
   _green_zone = calc_new_green_zone(_green_zone,
                                     logged_cards_scan_time,
                                     processed_logged_cards,
+                                    predicted_card_time_ms,
                                     goal_ms);
   _yellow_zone = calc_new_yellow_zone(_green_zone, _min_yellow_zone_size);
   _red_zone = calc_new_red_zone(_green_zone, _yellow_zone);
@@ -378,11 +397,12 @@ void G1ConcurrentRefine::update_zones(double logged_cards_scan_time,
 
 void G1ConcurrentRefine::adjust(double logged_cards_scan_time,
                                 size_t processed_logged_cards,
+                                double predicted_card_time_ms,
                                 double goal_ms) {
   G1DirtyCardQueueSet& dcqs = G1BarrierSet::dirty_card_queue_set();
 
   if (G1UseAdaptiveConcRefinement) {
-    update_zones(logged_cards_scan_time, processed_logged_cards, goal_ms);
+    update_zones(logged_cards_scan_time, processed_logged_cards, predicted_card_time_ms, goal_ms);
 
     // Change the barrier params
     if (max_num_threads() == 0) {
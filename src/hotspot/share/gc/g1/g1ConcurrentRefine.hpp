@@ -101,6 +101,7 @@ class G1ConcurrentRefine : public CHeapObj<mtGC> {
   // Update green/yellow/red zone values based on how well goals are being met.
   void update_zones(double logged_cards_scan_time,
                     size_t processed_logged_cards,
+                    double predicted_card_time_ms,
                     double goal_ms);
 
   static uint worker_id_offset();
@@ -116,8 +117,12 @@ public:
 
   void stop();
 
-  // Adjust refinement thresholds based on work done during the pause and the goal time.
-  void adjust(double logged_cards_scan_time, size_t processed_logged_cards, double goal_ms);
+  // Adjust refinement thresholds based on work done during the pause, the
+  // predicted pause time per logged card and the goal time.
+  void adjust(double logged_cards_scan_time,
+              size_t processed_logged_cards,
+              double predicted_card_time_ms,
+              double goal_ms);
 
   // Return total of concurrent refinement stats for the
   // ConcurrentRefineThreads.  Also reset the stats for the threads.
@@ -386,8 +386,7 @@ class G1RefineBufferedCards : public StackObj {
     assert(start <= _node_buffer_size, "invariant");
 
     // Two-fingered compaction algorithm similar to the filtering mechanism in
-    // SATBMarkQueue. The main difference is that clean_card_before_refine()
-    // could change the buffer element in-place.
+    // SATBMarkQueue.
     // We don't check for SuspendibleThreadSet::should_yield(), because
     // cleaning and redirtying the cards is fast.
     CardTable::CardValue** src = &_node_buffer[start];
@@ -395,10 +394,10 @@ class G1RefineBufferedCards : public StackObj {
     assert(src <= dst, "invariant");
     for ( ; src < dst; ++src) {
       // Search low to high for a card to keep.
-      if (_g1rs->clean_card_before_refine(src)) {
+      if (_g1rs->clean_card_before_refine(*src)) {
         // Found keeper.  Search high to low for a card to discard.
         while (src < --dst) {
-          if (!_g1rs->clean_card_before_refine(dst)) {
+          if (!_g1rs->clean_card_before_refine(*dst)) {
             *dst = *src;         // Replace discard with keeper.
             break;
           }
@@ -35,19 +35,41 @@ class G1RedirtyCardsQueueSet;
 
 // Task to fixup self-forwarding pointers
 // installed as a result of an evacuation failure.
+//
+// Only the objects recorded in the G1EvacFailureObjectsSet of each failed
+// region are visited. Failed regions are split into chunks that workers claim
+// individually, so that even a single failed region is processed by all of
+// them. The worker completing the last chunk of a region finishes that region.
 class G1ParRemoveSelfForwardPtrsTask: public AbstractGangTask {
 protected:
   G1CollectedHeap* _g1h;
   G1RedirtyCardsQueueSet* _rdcqs;
-  HeapRegionClaimer _hrclaimer;
+  bool _during_concurrent_start;
+
+  uint _num_regions;
+  uint _chunks_per_region;
+  size_t _chunk_words;
+  uint volatile _next_chunk;
+
+  // Per failed region, the number of chunks not yet processed and the
+  // live bytes found so far.
+  uint volatile* _num_chunks_remaining;
+  size_t volatile* _live_bytes;
 
   uint volatile _num_failed_regions;
 
+  static uint chunks_per_region();
+
+  void prepare_region(HeapRegion* hr, bool during_concurrent_mark);
+  void finish_region(HeapRegion* hr, size_t live_bytes);
+
 public:
   G1ParRemoveSelfForwardPtrsTask(G1RedirtyCardsQueueSet* rdcqs);
+  ~G1ParRemoveSelfForwardPtrsTask();
 
   void work(uint worker_id);
 
+  uint num_chunks() const { return _num_regions * _chunks_per_region; }
   uint num_failed_regions() const;
 };
 
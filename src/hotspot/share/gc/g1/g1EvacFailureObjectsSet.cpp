@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#include "precompiled.hpp"
+#include "gc/g1/g1EvacFailureObjectsSet.hpp"
+#include "gc/g1/heapRegion.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/safepoint.hpp"
+#include "utilities/bitMap.inline.hpp"
+
+G1EvacFailureObjectsSet::FreeBitmapList G1EvacFailureObjectsSet::_free_bitmaps;
+
+BitMap::idx_t G1EvacFailureObjectsSet::size_in_bits() {
+  return HeapRegion::GrainWords >> LogMinObjAlignment;
+}
+
+size_t G1EvacFailureObjectsSet::size_in_words() {
+  return BitMap::calc_size_in_words(size_in_bits());
+}
+
+BitMap::bm_word_t* G1EvacFailureObjectsSet::take_bitmap() {
+  BitMap::bm_word_t* map = reinterpret_cast<BitMap::bm_word_t*>(_free_bitmaps.pop());
+  if (map == NULL) {
+    map = NEW_C_HEAP_ARRAY(BitMap::bm_word_t, size_in_words(), mtGC);
+  }
+  memset(map, 0, size_in_words() * sizeof(BitMap::bm_word_t));
+  return map;
+}
+
+void G1EvacFailureObjectsSet::return_bitmap(BitMap::bm_word_t* map) {
+  STATIC_ASSERT(sizeof(FreeBitmap) <= sizeof(BitMap::bm_word_t));
+  _free_bitmaps.push(*reinterpret_cast<FreeBitmap*>(map));
+}
+
+BitMapView G1EvacFailureObjectsSet::bitmap() {
+  BitMap::bm_word_t* map = Atomic::load_acquire(&_map);
+  if (map == NULL) {
+    BitMap::bm_word_t* new_map = take_bitmap();
+    map = Atomic::cmpxchg(&_map, (BitMap::bm_word_t*)NULL, new_map);
+    if (map == NULL) {
+      map = new_map;
+    } else {
+      // Some other thread installed its bitmap first. Other threads may
+      // be taking bitmaps right now, so pushing this one could cause ABA.
+      FREE_C_HEAP_ARRAY(BitMap::bm_word_t, new_map);
+    }
+  }
+  return BitMapView(map, size_in_bits());
+}
+
+void G1EvacFailureObjectsSet::record(oop obj) {
+  HeapWord* obj_addr = cast_from_oop<HeapWord*>(obj);
+  assert(obj_addr >= _bottom && obj_addr < _bottom + HeapRegion::GrainWords,
+         "Object " PTR_FORMAT " outside of region starting at " PTR_FORMAT,
+         p2i(obj_addr), p2i(_bottom));
+  bitmap().par_set_bit(addr_to_offset(obj_addr), memory_order_relaxed);
+}
+
+HeapWord* G1EvacFailureObjectsSet::next_recorded(HeapWord* addr, HeapWord* limit) const {
+  assert(addr <= limit, "precondition");
+  BitMap::bm_word_t* map = Atomic::load(&_map);
+  if (map == NULL || addr == limit) {
+    return limit;
+  }
+  BitMapView bm(map, size_in_bits());
+  BitMap::idx_t limit_offset = addr_to_offset(limit);
+  BitMap::idx_t offset = bm.get_next_one_offset(addr_to_offset(addr), limit_offset);
+  return offset == limit_offset ? limit : offset_to_addr(offset);
+}
+
+void G1EvacFailureObjectsSet::clear() {
+  BitMap::bm_word_t* map = Atomic::load(&_map);
+  if (map != NULL) {
+    Atomic::store(&_map, (BitMap::bm_word_t*)NULL);
+    return_bitmap(map);
+  }
+}
+
+void G1EvacFailureObjectsSet::trim_free_bitmaps(uint max_bitmaps) {
+  assert_at_safepoint();
+  FreeBitmap* bitmap = _free_bitmaps.pop_all();
+  uint kept = 0;
+  while (bitmap != NULL) {
+    FreeBitmap* next = FreeBitmapList::next(*bitmap);
+    if (kept < max_bitmaps) {
+      _free_bitmaps.push(*bitmap);
+      kept++;
+    } else {
+      FREE_C_HEAP_ARRAY(BitMap::bm_word_t, reinterpret_cast<BitMap::bm_word_t*>(bitmap));
+    }
+    bitmap = next;
+  }
+}
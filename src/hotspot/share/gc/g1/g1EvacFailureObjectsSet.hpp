@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#ifndef SHARE_GC_G1_G1EVACFAILUREOBJECTSSET_HPP
+#define SHARE_GC_G1_G1EVACFAILUREOBJECTSSET_HPP
+
+#include "memory/allocation.hpp"
+#include "oops/oopsHierarchy.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/bitMap.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/lockFreeStack.hpp"
+
+// Records the objects of a single region that failed evacuation, i.e. that
+// have been self-forwarded, in a bitmap with one bit per possible object start.
+// A region only takes a bitmap when it actually fails evacuation, and returns
+// it after the self-forwards have been removed. This allows removal to visit
+// exactly these objects instead of walking the whole region.
+//
+// Returned bitmaps are kept on a free list and reused by later pauses. After
+// self-forward removal the free list is trimmed to a few bitmaps, so a pause
+// with many failed regions does not pin their bitmaps for the lifetime of the
+// VM. Bitmaps are taken during evacuation and returned during self-forward
+// removal, never at the same time, so the free list is not subject to ABA.
+class G1EvacFailureObjectsSet {
+  // A bitmap on the free list, linked through its first word.
+  struct FreeBitmap {
+    FreeBitmap* volatile _next;
+    static FreeBitmap* volatile* next_ptr(FreeBitmap& bitmap) { return &bitmap._next; }
+  };
+  typedef LockFreeStack<FreeBitmap, &FreeBitmap::next_ptr> FreeBitmapList;
+  static FreeBitmapList _free_bitmaps;
+
+  HeapWord* _bottom;
+  BitMap::bm_word_t* volatile _map;
+
+  static BitMap::idx_t size_in_bits();
+  static size_t size_in_words();
+
+  static BitMap::bm_word_t* take_bitmap();
+  static void return_bitmap(BitMap::bm_word_t* map);
+
+  BitMap::idx_t addr_to_offset(const HeapWord* addr) const {
+    return pointer_delta(addr, _bottom) >> LogMinObjAlignment;
+  }
+  HeapWord* offset_to_addr(BitMap::idx_t offset) const {
+    return _bottom + (offset << LogMinObjAlignment);
+  }
+
+  // Returns the bitmap, allocating it first if necessary.
+  BitMapView bitmap();
+
+public:
+  G1EvacFailureObjectsSet(HeapWord* bottom) : _bottom(bottom), _map(NULL) { }
+  ~G1EvacFailureObjectsSet() { clear(); }
+
+  bool is_empty() const { return Atomic::load(&_map) == NULL; }
+
+  // Record the given object as failed. May be called by multiple threads
+  // at the same time.
+  void record(oop obj);
+
+  // Returns the address of the first recorded object at or after "addr",
+  // and before "limit"; returns "limit" if there is none.
+  HeapWord* next_recorded(HeapWord* addr, HeapWord* limit) const;
+
+  // Forget all recorded objects and return the bitmap to the free list.
+  void clear();
+
+  // Free all but max_bitmaps bitmaps on the free list. Must not be called
+  // while bitmaps are taken or returned.
+  static void trim_free_bitmaps(uint max_bitmaps);
+};
+
+#endif // SHARE_GC_G1_G1EVACFAILUREOBJECTSSET_HPP
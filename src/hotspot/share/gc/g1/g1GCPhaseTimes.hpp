@@ -58,7 +58,6 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     MergeRS,
     OptMergeRS,
     MergeLB,
-    MergeHCC,
     ScanHR,
     OptScanHR,
     CodeRoots,
@@ -79,7 +78,6 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     RemoveSelfForwardingPtr,
     ClearCardTable,
     RecalculateUsed,
-    ResetHotCardCache,
     PurgeCodeRoots,
 #if COMPILER2_OR_JVMCI
     UpdateDerivedPointers,
@@ -112,11 +110,6 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     ScanHRUsedMemory
   };
 
-  enum GCMergeHCCWorkItems {
-    MergeHCCDirtyCards,
-    MergeHCCSkippedCards
-  };
-
   enum GCMergeLBWorkItems {
     MergeLBDirtyCards,
     MergeLBSkippedCards
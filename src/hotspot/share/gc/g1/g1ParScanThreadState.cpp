@@ -606,9 +606,10 @@ oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m) {
     HeapRegion* r = _g1h->heap_region_containing(old);
 
     if (r->set_evacuation_failed()) {
-      _g1h->notify_region_failed_evacuation();
+      _g1h->notify_region_failed_evacuation(r->hrm_index());
       _g1h->hr_printer()->evac_failure(r);
     }
+    r->evac_failure_objs()->record(old);
 
     _g1h->preserve_mark_during_evac_failure(_worker_id, old, m);
 
@@ -33,7 +33,6 @@
 #include "gc/g1/g1ConcurrentRefine.hpp"
 #include "gc/g1/g1ConcurrentRefineStats.hpp"
 #include "gc/g1/g1CollectionSetChooser.hpp"
-#include "gc/g1/g1HotCardCache.hpp"
 #include "gc/g1/g1IHOPControl.hpp"
 #include "gc/g1/g1GCPhaseTimes.hpp"
 #include "gc/g1/g1Policy.hpp"
@@ -620,6 +619,13 @@ double G1Policy::logged_cards_processing_time() const {
   return (all_cards_processing_time * logged_dirty_cards / scan_heap_roots_cards) + average_time_ms(G1GCPhaseTimes::MergeLB);
 }
 
+double G1Policy::predict_logged_card_time_ms() const {
+  // A card left in the logs at the start of a young pause is merged and then
+  // scanned like any other card.
+  return _analytics->predict_card_merge_time_ms(1, true /* for_young_gc */) +
+         _analytics->predict_card_scan_time_ms(1, true /* for_young_gc */);
+}
+
 // Anything below that is considered to be zero
 #define MIN_TIMER_GRANULARITY 0.0000001
 
@@ -687,10 +693,8 @@ void G1Policy::record_collection_pause_end(double pause_time_ms, bool concurrent
 
   _eden_surv_rate_group->start_adding_regions();
 
-  double merge_hcc_time_ms = average_time_ms(G1GCPhaseTimes::MergeHCC);
   if (update_stats) {
-    size_t const total_log_buffer_cards = p->sum_thread_work_items(G1GCPhaseTimes::MergeHCC, G1GCPhaseTimes::MergeHCCDirtyCards) +
-                                          p->sum_thread_work_items(G1GCPhaseTimes::MergeLB, G1GCPhaseTimes::MergeLBDirtyCards);
+    size_t const total_log_buffer_cards = p->sum_thread_work_items(G1GCPhaseTimes::MergeLB, G1GCPhaseTimes::MergeLBDirtyCards);
     // Update prediction for card merge; MergeRSDirtyCards includes the cards from the Eager Reclaim phase.
     size_t const total_cards_merged = p->sum_thread_work_items(G1GCPhaseTimes::MergeRS, G1GCPhaseTimes::MergeRSDirtyCards) +
                                       p->sum_thread_work_items(G1GCPhaseTimes::OptMergeRS, G1GCPhaseTimes::MergeRSDirtyCards) +
@@ -703,7 +707,6 @@ void G1Policy::record_collection_pause_end(double pause_time_ms, bool concurrent
     if (total_cards_merged > CardsNumSamplingThreshold) {
       double avg_time_merge_cards = average_time_ms(G1GCPhaseTimes::MergeER) +
                                     average_time_ms(G1GCPhaseTimes::MergeRS) +
-                                    average_time_ms(G1GCPhaseTimes::MergeHCC) +
                                     average_time_ms(G1GCPhaseTimes::MergeLB) +
                                     average_time_ms(G1GCPhaseTimes::OptMergeRS);
       _analytics->report_cost_per_card_merge_ms(avg_time_merge_cards / total_cards_merged,
@@ -808,23 +811,19 @@ void G1Policy::record_collection_pause_end(double pause_time_ms, bool concurrent
   // Note that _mmu_tracker->max_gc_time() returns the time in seconds.
   double scan_logged_cards_time_goal_ms = _mmu_tracker->max_gc_time() * MILLIUNITS * G1RSetUpdatingPauseTimePercent / 100.0;
 
-  if (scan_logged_cards_time_goal_ms < merge_hcc_time_ms) {
-    log_debug(gc, ergo, refine)("Adjust concurrent refinement thresholds (scanning the HCC expected to take longer than Update RS time goal)."
-                                "Logged Cards Scan time goal: %1.2fms Scan HCC time: %1.2fms",
-                                scan_logged_cards_time_goal_ms, merge_hcc_time_ms);
-
-    scan_logged_cards_time_goal_ms = 0;
-  } else {
-    scan_logged_cards_time_goal_ms -= merge_hcc_time_ms;
-  }
-
   double const logged_cards_time = logged_cards_processing_time();
+  // Without enough samples the prediction is mostly the default scan cost;
+  // the refinement zones are then adjusted from the measured time only.
+  double const predicted_logged_card_time_ms =
+    _analytics->enough_young_card_cost_samples_available() ? predict_logged_card_time_ms() : 0.0;
 
-  log_debug(gc, ergo, refine)("Concurrent refinement times: Logged Cards Scan time goal: %1.2fms Logged Cards Scan time: %1.2fms HCC time: %1.2fms",
-                              scan_logged_cards_time_goal_ms, logged_cards_time, merge_hcc_time_ms);
+  log_debug(gc, ergo, refine)("Concurrent refinement times: Logged Cards Scan time goal: %1.2fms Logged Cards Scan time: %1.2fms "
+                              "Predicted time per logged card: %1.6fms",
+                              scan_logged_cards_time_goal_ms, logged_cards_time, predicted_logged_card_time_ms);
 
   _g1h->concurrent_refine()->adjust(logged_cards_time,
                                     phase_times()->sum_thread_work_items(G1GCPhaseTimes::MergeLB, G1GCPhaseTimes::MergeLBDirtyCards),
+                                    predicted_logged_card_time_ms,
                                     scan_logged_cards_time_goal_ms);
 }
 
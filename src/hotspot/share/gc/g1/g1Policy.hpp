@@ -111,6 +111,8 @@ class G1Policy: public CHeapObj<mtGC> {
   }
 
   double logged_cards_processing_time() const;
+  // Predicted pause time needed to process a single card left in the logs.
+  double predict_logged_card_time_ms() const;
 public:
   const G1Predictions& predictor() const { return _predictor; }
   const G1Analytics* analytics()   const { return const_cast<const G1Analytics*>(_analytics); }
@@ -43,7 +43,6 @@ class CodeBlobClosure;
 class G1AbstractSubTask;
 class G1CollectedHeap;
 class G1CMBitMap;
-class G1HotCardCache;
 class G1RemSetScanState;
 class G1ParScanThreadState;
 class G1ParScanThreadStateSet;
@@ -66,7 +65,6 @@ private:
 
   G1CardTable*           _ct;
   G1Policy*              _g1p;
-  G1HotCardCache*        _hot_card_cache;
   G1RemSetSamplingTask*  _sampling_task;
 
   void print_merge_heap_roots_stats();
@@ -80,8 +78,7 @@ public:
   void initialize(uint max_reserved_regions);
 
   G1RemSet(G1CollectedHeap* g1h,
-           G1CardTable* ct,
-           G1HotCardCache* hot_card_cache);
+           G1CardTable* ct);
   ~G1RemSet();
 
   // Initialize and schedule young remembered set sampling task.
@@ -98,7 +95,7 @@ public:
                        G1GCPhaseTimes::GCParPhases objcopy_phase,
                        bool remember_already_scanned_cards);
 
-  // Merge cards from various sources (remembered sets, hot card cache, log buffers)
+  // Merge cards from various sources (remembered sets, log buffers)
   // and calculate the cards that need to be scanned later (via scan_heap_roots()).
   // If initial_evacuation is set, this is called during the initial evacuation.
   void merge_heap_roots(bool initial_evacuation);
@@ -126,10 +123,9 @@ public:
 
   // Two methods for concurrent refinement support, executed concurrently to
   // the mutator:
-  // Cleans the card at "*card_ptr_addr" before refinement, returns true iff the
-  // card needs later refinement. Note that "*card_ptr_addr" could be updated to
-  // a different card due to use of hot card cache.
-  bool clean_card_before_refine(CardValue** const card_ptr_addr);
+  // Cleans the card at "card_ptr" before refinement, returns true iff the
+  // card needs later refinement.
+  bool clean_card_before_refine(CardValue* const card_ptr);
   // Refine the region corresponding to "card_ptr". Must be called after
   // being filtered by clean_card_before_refine(), and after proper
   // fence/synchronization.
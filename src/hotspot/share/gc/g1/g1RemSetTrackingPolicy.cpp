@@ -23,12 +23,25 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1CollectionSetChooser.hpp"
+#include "gc/g1/g1ConcurrentMark.inline.hpp"
+#include "gc/g1/g1Policy.hpp"
 #include "gc/g1/g1RemSetTrackingPolicy.hpp"
 #include "gc/g1/heapRegion.inline.hpp"
 #include "gc/g1/heapRegionRemSet.hpp"
+#include "logging/log.hpp"
 #include "runtime/safepoint.hpp"
 
+G1RemSetTrackingPolicy::G1RemSetTrackingPolicy() :
+  _rebuild_live_threshold_bytes(SIZE_MAX),
+  _rebuild_excluded_reclaimable_bytes(0) { }
+
+size_t G1RemSetTrackingPolicy::total_live_bytes(HeapRegion* r, size_t live_bytes) {
+  size_t between_ntams_and_top = (r->top() - r->next_top_at_mark_start()) * HeapWordSize;
+  return live_bytes + between_ntams_and_top;
+}
+
 bool G1RemSetTrackingPolicy::needs_scan_for_rebuild(HeapRegion* r) const {
   // All non-free, non-young, non-closed archive regions need to be scanned for references;
   // At every gc we gather references to other regions in young, and closed archive
@@ -104,6 +117,95 @@ bool G1RemSetTrackingPolicy::update_humongous_before_rebuild(HeapRegion* r, bool
   return selected_for_rebuild;
 }
 
+// Old regions that are evacuation candidates by occupancy, bucketed by their total
+// live bytes. Used to find the most occupied regions that G1CollectionSetChooser
+// would prune from the candidates without ever evacuating them.
+class G1RebuildLivenessHistogram : public HeapRegionClosure {
+public:
+  static const uint NumBuckets = 100;
+
+private:
+  G1ConcurrentMark* _cm;
+
+  uint _num_regions[NumBuckets];
+  size_t _reclaimable_bytes[NumBuckets];
+  uint _total_regions;
+
+public:
+  G1RebuildLivenessHistogram(G1ConcurrentMark* cm) : _cm(cm), _total_regions(0) {
+    for (uint i = 0; i < NumBuckets; i++) {
+      _num_regions[i] = 0;
+      _reclaimable_bytes[i] = 0;
+    }
+  }
+
+  static size_t bucket_start_bytes(uint bucket) {
+    return HeapRegion::GrainBytes / NumBuckets * bucket;
+  }
+
+  virtual bool do_heap_region(HeapRegion* r) {
+    if (!r->is_old() || r->is_archive() || r->rem_set()->is_tracked()) {
+      return false;
+    }
+    size_t const live_bytes = G1RemSetTrackingPolicy::total_live_bytes(r, _cm->live_bytes(r->hrm_index()));
+    if (live_bytes == 0 || !G1CollectionSetChooser::region_occupancy_low_enough_for_evac(live_bytes)) {
+      return false;
+    }
+    uint const bucket = MIN2((uint)(live_bytes / (HeapRegion::GrainBytes / NumBuckets)), NumBuckets - 1);
+    _num_regions[bucket]++;
+    _reclaimable_bytes[bucket] += HeapRegion::GrainBytes - live_bytes;
+    _total_regions++;
+    return false;
+  }
+
+  // Returns the start of the lowest bucket that may be excluded from rebuild.
+  // Starting with the most occupied regions, exclude buckets as long as their
+  // reclaimable bytes stay within max_wasted and enough regions remain for the
+  // minimum old collection set length of each mixed gc. The reclaimable bytes
+  // of the excluded regions are returned in excluded_reclaimable.
+  size_t exclude_threshold_bytes(size_t max_wasted, size_t* excluded_reclaimable) const {
+    uint const gc_num = (uint) MAX2(G1MixedGCCountTarget, (uintx) 1);
+    uint const min_old_cset_length = (_total_regions + gc_num - 1) / gc_num;
+    uint remaining = _total_regions;
+    size_t wasted = 0;
+    uint threshold_bucket = NumBuckets;
+
+    for (uint bucket = NumBuckets; bucket > 0; bucket--) {
+      uint const num_regions = _num_regions[bucket - 1];
+      if (num_regions == 0) {
+        continue;
+      }
+      uint const new_remaining = remaining - num_regions;
+      if (new_remaining < min_old_cset_length ||
+          wasted + _reclaimable_bytes[bucket - 1] > max_wasted) {
+        break;
+      }
+      remaining = new_remaining;
+      wasted += _reclaimable_bytes[bucket - 1];
+      threshold_bucket = bucket - 1;
+    }
+    *excluded_reclaimable = wasted;
+    return threshold_bucket == NumBuckets ? SIZE_MAX : bucket_start_bytes(threshold_bucket);
+  }
+};
+
+void G1RemSetTrackingPolicy::calc_rebuild_live_threshold() {
+  assert(SafepointSynchronize::is_at_safepoint(), "should be at safepoint");
+
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+  G1RebuildLivenessHistogram histogram(g1h->concurrent_mark());
+  g1h->heap_region_iterate(&histogram);
+
+  // Only use up half of the allowed waste here: pruning the candidates after
+  // the rebuild is based on the actual gc efficiency, and may remove further
+  // regions on its own.
+  size_t const max_wasted = g1h->policy()->allowed_waste_in_collection_set() / 2;
+  _rebuild_live_threshold_bytes = histogram.exclude_threshold_bytes(max_wasted, &_rebuild_excluded_reclaimable_bytes);
+
+  log_debug(gc, remset, tracking)("Remembered set rebuild live threshold " SIZE_FORMAT "B, excluded " SIZE_FORMAT "B reclaimable",
+                                  _rebuild_live_threshold_bytes, _rebuild_excluded_reclaimable_bytes);
+}
+
 bool G1RemSetTrackingPolicy::update_before_rebuild(HeapRegion* r, size_t live_bytes) {
   assert(SafepointSynchronize::is_at_safepoint(), "should be at safepoint");
   assert(!r->is_humongous(), "Region %u is humongous", r->hrm_index());
@@ -116,8 +218,7 @@ bool G1RemSetTrackingPolicy::update_before_rebuild(HeapRegion* r, size_t live_by
 
   assert(!r->rem_set()->is_updating(), "Remembered set of region %u is updating before rebuild", r->hrm_index());
 
-  size_t between_ntams_and_top = (r->top() - r->next_top_at_mark_start()) * HeapWordSize;
-  size_t total_live_bytes = live_bytes + between_ntams_and_top;
+  size_t const total_live_bytes = G1RemSetTrackingPolicy::total_live_bytes(r, live_bytes);
 
   bool selected_for_rebuild = false;
   // For old regions, to be of interest for rebuilding the remembered set the following must apply:
@@ -125,8 +226,10 @@ bool G1RemSetTrackingPolicy::update_before_rebuild(HeapRegion* r, size_t live_by
   // - Only need to rebuild non-complete remembered sets.
   // - Otherwise only add those old gen regions which occupancy is low enough that there
   // is a chance that we will ever evacuate them in the mixed gcs.
+  // - Skip the most occupied of these that would be pruned from the candidates anyway.
   if ((total_live_bytes > 0) &&
       G1CollectionSetChooser::region_occupancy_low_enough_for_evac(total_live_bytes) &&
+      total_live_bytes < _rebuild_live_threshold_bytes &&
       !r->rem_set()->is_tracked()) {
 
     r->rem_set()->set_state_updating();
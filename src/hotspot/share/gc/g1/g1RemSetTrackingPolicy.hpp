@@ -33,7 +33,20 @@
 // the remembered set, ie. when it should be tracked, and if/when the remembered
 // set is complete.
 class G1RemSetTrackingPolicy : public CHeapObj<mtGC> {
+  friend class G1RebuildLivenessHistogram;
+
+  // Old regions with at least this many live bytes are not selected for
+  // remembered set rebuild.
+  size_t _rebuild_live_threshold_bytes;
+  // Reclaimable bytes of the old regions not selected because of it. They
+  // count against the allowed waste when pruning the candidates.
+  size_t _rebuild_excluded_reclaimable_bytes;
+
+  static size_t total_live_bytes(HeapRegion* r, size_t live_bytes);
+
 public:
+  G1RemSetTrackingPolicy();
+
   // Do we need to scan the given region to get all outgoing references for remembered
   // set rebuild?
   bool needs_scan_for_rebuild(HeapRegion* r) const;
@@ -44,6 +57,11 @@ public:
   // Update remembered set tracking state for humongous regions before we are going to
   // rebuild remembered sets. Called at safepoint in the remark pause.
   bool update_humongous_before_rebuild(HeapRegion* r, bool is_live);
+  // Determine the live bytes threshold for old regions to be selected for remembered
+  // set rebuild, using the liveness information of the just completed marking.
+  // Called at safepoint in the remark pause before update_before_rebuild().
+  void calc_rebuild_live_threshold();
+  size_t rebuild_excluded_reclaimable_bytes() const { return _rebuild_excluded_reclaimable_bytes; }
   // Update remembered set tracking state before we are going to rebuild remembered
   // sets. Called at safepoint in the remark pause.
   bool update_before_rebuild(HeapRegion* r, size_t live_bytes);
@@ -84,7 +84,6 @@ public:
 // Second set of post evacuate collection set tasks containing (s means serial):
 // - Eagerly Reclaim Humongous Objects (s)
 // - Purge Code Roots (s)
-// - Reset Hot Card Cache (s)
 // - Update Derived Pointers (s)
 // - Redirty Logged Cards
 // - Restore Preserved Marks (on evacuation failure)
@@ -92,7 +91,6 @@ public:
 class G1PostEvacuateCollectionSetCleanupTask2 : public G1BatchedGangTask {
   class EagerlyReclaimHumongousObjectsTask;
   class PurgeCodeRootsTask;
-  class ResetHotCardCacheTask;
 #if COMPILER2_OR_JVMCI
   class UpdateDerivedPointersTask;
 #endif
@@ -108,14 +106,6 @@ public:
                                           const size_t* surviving_young_words);
 };
 
-class G1PostEvacuateCollectionSetCleanupTask2::ResetHotCardCacheTask : public G1AbstractSubTask {
-public:
-  ResetHotCardCacheTask() : G1AbstractSubTask(G1GCPhaseTimes::ResetHotCardCache) { }
-
-  double worker_cost() const override { return 0.5; }
-  void do_work(uint worker_id) override;
-};
-
 class G1PostEvacuateCollectionSetCleanupTask2::PurgeCodeRootsTask : public G1AbstractSubTask {
 public:
   PurgeCodeRootsTask() : G1AbstractSubTask(G1GCPhaseTimes::PurgeCodeRoots) { }
@@ -145,14 +145,6 @@
           "Select green, yellow and red zones adaptively to meet the "      \
           "the pause requirements.")                                        \
                                                                             \
-  product(size_t, G1ConcRSLogCacheSize, 10,                                 \
-          "Log base 2 of the length of conc RS hot-card cache.")            \
-          range(0, 27)                                                      \
-                                                                            \
-  product(uintx, G1ConcRSHotCardLimit, 4,                                   \
-          "The threshold that defines (>=) a hot card.")                    \
-          range(0, max_jubyte)                                              \
-                                                                            \
   develop(intx, G1RSetRegionEntriesBase, 256,                               \
           "Max number of regions in a fine-grain table per MB.")            \
           range(1, max_jint/wordSize)                                       \
@@ -233,6 +225,14 @@
           "The target number of mixed GCs after a marking cycle.")          \
           range(0, max_uintx)                                               \
                                                                             \
+  product(uintx, G1OldRegionObjectMaxPercent, 0, EXPERIMENTAL,              \
+          "Objects larger than half a heap region, but at most this "       \
+          "percentage of a heap region, are allocated into old regions "    \
+          "instead of as humongous objects. The rest of such a region is "  \
+          "used for promotion, and the objects can be evacuated by mixed "  \
+          "collections. 0 disables this.")                                  \
+          range(0, 99)                                                      \
+                                                                            \
   product(bool, G1EagerReclaimHumongousObjects, true, EXPERIMENTAL,         \
           "Try to reclaim dead large objects at every young GC.")           \
                                                                             \
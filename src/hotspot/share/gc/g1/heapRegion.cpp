@@ -243,6 +243,7 @@ HeapRegion::HeapRegion(uint hrm_index,
   _type(),
   _humongous_start_region(NULL),
   _evacuation_failed(false),
+  _evac_failure_objs(mr.start()),
   _index_in_opt_cset(InvalidCSetIndex),
   _next(NULL), _prev(NULL),
 #ifdef ASSERT
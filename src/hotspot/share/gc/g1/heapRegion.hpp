@@ -26,6 +26,7 @@
 #define SHARE_GC_G1_HEAPREGION_HPP
 
 #include "gc/g1/g1BlockOffsetTable.hpp"
+#include "gc/g1/g1EvacFailureObjectsSet.hpp"
 #include "gc/g1/g1HeapRegionTraceType.hpp"
 #include "gc/g1/g1SurvRateGroup.hpp"
 #include "gc/g1/heapRegionTracer.hpp"
@@ -198,6 +199,18 @@ public:
     _bot_part.update();
   }
 
+  // Update the BOT for the block [start, end) independently of any other
+  // blocks in this region; see G1BlockOffsetTablePart::update_for_block().
+  void update_bot_for_block(HeapWord* start, HeapWord* end) {
+    _bot_part.update_for_block(start, end);
+  }
+
+  // Advance the BOT threshold to top() once update_bot_for_block() has
+  // been applied to every block below it.
+  void update_bot_threshold_to_top() {
+    _bot_part.set_threshold_after(top());
+  }
+
 private:
   // The remembered set for this region.
   HeapRegionRemSet* _rem_set;
@@ -213,6 +226,9 @@ private:
   // True iff an attempt to evacuate an object in the region failed.
   volatile bool _evacuation_failed;
 
+  // The objects that failed evacuation in this region, if any.
+  G1EvacFailureObjectsSet _evac_failure_objs;
+
   static const uint InvalidCSetIndex = UINT_MAX;
 
   // The index in the optional regions array, if this region
@@ -507,6 +523,8 @@ public:
 
   inline void reset_evacuation_failed();
 
+  G1EvacFailureObjectsSet* evac_failure_objs() { return &_evac_failure_objs; }
+
   // Notify the region that we are about to start processing
   // self-forwarded objects during evac failure handling.
   void note_self_forwarding_removal_start(bool during_concurrent_start,
@@ -350,9 +350,11 @@ HeapWord* HeapRegion::oops_on_memregion_seq_iterate_careful(MemRegion mr,
   assert(is_old() || is_archive(), "Wrongly trying to iterate over region %u type %s", _hrm_index, get_type_str());
 
   // Because mr has been trimmed to what's been allocated in this
-  // region, the parts of the heap that are examined here are always
-  // parsable; there's no need to use klass_or_null to detect
-  // in-progress allocation.
+  // region, the parts of the heap that are examined here are parsable,
+  // except for an object that G1CollectedHeap::old_region_obj_allocate()
+  // placed at the bottom of a free region. Until the allocating thread
+  // sets its klass, that object has a zeroed header, and it is the only
+  // object in the region.
 
   // Cache the boundaries of the memory region in some const locals
   HeapWord* const start = mr.start();
@@ -363,6 +365,13 @@ HeapWord* HeapRegion::oops_on_memregion_seq_iterate_careful(MemRegion mr,
   // object containing the start of the region.
   HeapWord* cur = block_start(start);
 
+  // If concurrent and klass_or_null is NULL, the object has not been
+  // published yet, so the card is stale. As for humongous objects, we
+  // must return failure because the card has already been cleaned.
+  if (!is_gc_active && (cast_to_oop(cur)->klass_or_null_acquire() == NULL)) {
+    return NULL;
+  }
+
 #ifdef ASSERT
   {
     assert(cur <= start,
@@ -63,7 +63,6 @@ public:
 HeapRegionManager::HeapRegionManager() :
   _bot_mapper(NULL),
   _cardtable_mapper(NULL),
-  _card_counts_mapper(NULL),
   _committed_map(),
   _allocated_heapregions_length(0),
   _regions(), _heap_mapper(NULL),
@@ -76,8 +75,7 @@ void HeapRegionManager::initialize(G1RegionToSpaceMapper* heap_storage,
                                    G1RegionToSpaceMapper* prev_bitmap,
                                    G1RegionToSpaceMapper* next_bitmap,
                                    G1RegionToSpaceMapper* bot,
-                                   G1RegionToSpaceMapper* cardtable,
-                                   G1RegionToSpaceMapper* card_counts) {
+                                   G1RegionToSpaceMapper* cardtable) {
   _allocated_heapregions_length = 0;
 
   _heap_mapper = heap_storage;
@@ -88,8 +86,6 @@ void HeapRegionManager::initialize(G1RegionToSpaceMapper* heap_storage,
   _bot_mapper = bot;
   _cardtable_mapper = cardtable;
 
-  _card_counts_mapper = card_counts;
-
   _regions.initialize(heap_storage->reserved(), HeapRegion::GrainBytes);
 
   _committed_map.initialize(reserved_length());
@@ -194,8 +190,6 @@ void HeapRegionManager::commit_regions(uint index, size_t num_regions, WorkGang*
 
   _bot_mapper->commit_regions(index, num_regions, pretouch_gang);
   _cardtable_mapper->commit_regions(index, num_regions, pretouch_gang);
-
-  _card_counts_mapper->commit_regions(index, num_regions, pretouch_gang);
 }
 
 void HeapRegionManager::uncommit_regions(uint start, uint num_regions) {
@@ -222,8 +216,6 @@ void HeapRegionManager::uncommit_regions(uint start, uint num_regions) {
   _bot_mapper->uncommit_regions(start, num_regions);
   _cardtable_mapper->uncommit_regions(start, num_regions);
 
-  _card_counts_mapper->uncommit_regions(start, num_regions);
-
   _committed_map.uncommit(start, end);
 }
 
@@ -276,8 +268,6 @@ void HeapRegionManager::clear_auxiliary_data_structures(uint start, uint num_reg
   _bot_mapper->signal_mapping_changed(start, num_regions);
   // Signal G1CardTable to clear the given regions.
   _cardtable_mapper->signal_mapping_changed(start, num_regions);
-  // Signal G1CardCounts to clear the given regions.
-  _card_counts_mapper->signal_mapping_changed(start, num_regions);
 }
 
 MemoryUsage HeapRegionManager::get_auxiliary_data_memory_usage() const {
@@ -285,15 +275,13 @@ MemoryUsage HeapRegionManager::get_auxiliary_data_memory_usage() const {
     _prev_bitmap_mapper->committed_size() +
     _next_bitmap_mapper->committed_size() +
     _bot_mapper->committed_size() +
-    _cardtable_mapper->committed_size() +
-    _card_counts_mapper->committed_size();
+    _cardtable_mapper->committed_size();
 
   size_t committed_sz =
     _prev_bitmap_mapper->reserved_size() +
     _next_bitmap_mapper->reserved_size() +
     _bot_mapper->reserved_size() +
-    _cardtable_mapper->reserved_size() +
-    _card_counts_mapper->reserved_size();
+    _cardtable_mapper->reserved_size();
 
   return MemoryUsage(0, used_sz, committed_sz, committed_sz);
 }
@@ -120,6 +120,9 @@ void PSOldGen::initialize_work(const char* perf_data_name, int level) {
   // ObjectSpace stuff
   //
 
+  // The old gen is a single MutableSpace rather than a MutableNUMASpace,
+  // since the start array and parallel compaction need one contiguous
+  // space. With UseNUMA its memory is interleaved across the nodes.
   _object_space = new MutableSpace(virtual_space()->alignment());
   object_space()->initialize(cmr,
                              SpaceDecorator::Clear,
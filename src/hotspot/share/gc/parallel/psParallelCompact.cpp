@@ -682,6 +682,58 @@ ParallelCompactData::summarize_split_space(size_t src_region,
   return source_next;
 }
 
+void ParallelCompactData::summarize_region(const SplitInfo& split_info,
+                                           size_t cur_region,
+                                           HeapWord* dest_addr,
+                                           size_t words)
+{
+  // Compute the destination_count for cur_region, and if necessary, update
+  // source_region for a destination region.  The source_region field is
+  // updated if cur_region is the first (left-most) region to be copied to a
+  // destination region.
+  //
+  // The destination_count calculation is a bit subtle.  A region that has
+  // data that compacts into itself does not count itself as a destination.
+  // This maintains the invariant that a zero count means the region is
+  // available and can be claimed and then filled.
+  uint destination_count = 0;
+  if (split_info.is_split(cur_region)) {
+    // The current region has been split:  the partial object will be copied
+    // to one destination space and the remaining data will be copied to
+    // another destination space.  Adjust the initial destination_count and,
+    // if necessary, set the source_region field if the partial object will
+    // cross a destination region boundary.
+    destination_count = split_info.destination_count();
+    if (destination_count == 2) {
+      size_t dest_idx = addr_to_region_idx(split_info.dest_region_addr());
+      _region_data[dest_idx].set_source_region(cur_region);
+    }
+  }
+
+  HeapWord* const last_addr = dest_addr + words - 1;
+  const size_t dest_region_1 = addr_to_region_idx(dest_addr);
+  const size_t dest_region_2 = addr_to_region_idx(last_addr);
+
+  // Initially assume that the destination regions will be the same and
+  // adjust the value below if necessary.  Under this assumption, if
+  // cur_region == dest_region_2, then cur_region will be compacted
+  // completely into itself.
+  destination_count += cur_region == dest_region_2 ? 0 : 1;
+  if (dest_region_1 != dest_region_2) {
+    // Destination regions differ; adjust destination_count.
+    destination_count += 1;
+    // Data from cur_region will be copied to the start of dest_region_2.
+    _region_data[dest_region_2].set_source_region(cur_region);
+  } else if (is_region_aligned(dest_addr)) {
+    // Data from cur_region will be copied to the start of the destination
+    // region.
+    _region_data[dest_region_1].set_source_region(cur_region);
+  }
+
+  _region_data[cur_region].set_destination_count(destination_count);
+  _region_data[cur_region].set_data_location(region_to_addr(cur_region));
+}
+
 bool ParallelCompactData::summarize(SplitInfo& split_info,
                                     HeapWord* source_beg, HeapWord* source_end,
                                     HeapWord** source_next,
@@ -715,51 +767,7 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
         return false;
       }
 
-      // Compute the destination_count for cur_region, and if necessary, update
-      // source_region for a destination region.  The source_region field is
-      // updated if cur_region is the first (left-most) region to be copied to a
-      // destination region.
-      //
-      // The destination_count calculation is a bit subtle.  A region that has
-      // data that compacts into itself does not count itself as a destination.
-      // This maintains the invariant that a zero count means the region is
-      // available and can be claimed and then filled.
-      uint destination_count = 0;
-      if (split_info.is_split(cur_region)) {
-        // The current region has been split:  the partial object will be copied
-        // to one destination space and the remaining data will be copied to
-        // another destination space.  Adjust the initial destination_count and,
-        // if necessary, set the source_region field if the partial object will
-        // cross a destination region boundary.
-        destination_count = split_info.destination_count();
-        if (destination_count == 2) {
-          size_t dest_idx = addr_to_region_idx(split_info.dest_region_addr());
-          _region_data[dest_idx].set_source_region(cur_region);
-        }
-      }
-
-      HeapWord* const last_addr = dest_addr + words - 1;
-      const size_t dest_region_1 = addr_to_region_idx(dest_addr);
-      const size_t dest_region_2 = addr_to_region_idx(last_addr);
-
-      // Initially assume that the destination regions will be the same and
-      // adjust the value below if necessary.  Under this assumption, if
-      // cur_region == dest_region_2, then cur_region will be compacted
-      // completely into itself.
-      destination_count += cur_region == dest_region_2 ? 0 : 1;
-      if (dest_region_1 != dest_region_2) {
-        // Destination regions differ; adjust destination_count.
-        destination_count += 1;
-        // Data from cur_region will be copied to the start of dest_region_2.
-        _region_data[dest_region_2].set_source_region(cur_region);
-      } else if (is_region_aligned(dest_addr)) {
-        // Data from cur_region will be copied to the start of the destination
-        // region.
-        _region_data[dest_region_1].set_source_region(cur_region);
-      }
-
-      _region_data[cur_region].set_destination_count(destination_count);
-      _region_data[cur_region].set_data_location(region_to_addr(cur_region));
+      summarize_region(split_info, cur_region, dest_addr, words);
       dest_addr += words;
     }
 
@@ -770,6 +778,34 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
   return true;
 }
 
+size_t ParallelCompactData::live_words_in_range(size_t beg_region,
+                                                size_t end_region) const
+{
+  size_t words = 0;
+  for (size_t cur_region = beg_region; cur_region < end_region; ++cur_region) {
+    words += _region_data[cur_region].data_size();
+  }
+  return words;
+}
+
+HeapWord* ParallelCompactData::summarize_range(const SplitInfo& split_info,
+                                               size_t beg_region,
+                                               size_t end_region,
+                                               HeapWord* dest_addr)
+{
+  for (size_t cur_region = beg_region; cur_region < end_region; ++cur_region) {
+    // The destination must be set even if the region has no data.
+    _region_data[cur_region].set_destination(dest_addr);
+
+    size_t words = _region_data[cur_region].data_size();
+    if (words > 0) {
+      summarize_region(split_info, cur_region, dest_addr, words);
+      dest_addr += words;
+    }
+  }
+  return dest_addr;
+}
+
 HeapWord* ParallelCompactData::calc_new_pointer(HeapWord* addr, ParCompactionManager* cm) const {
   assert(addr != NULL, "Should detect NULL oop earlier");
   assert(ParallelScavengeHeap::heap()->is_in(addr), "not in heap");
@@ -1430,15 +1466,110 @@ PSParallelCompact::compute_dense_prefix(const SpaceId id,
   return sd.region_to_addr(best_cp);
 }
 
+// Summarizes a range of regions that fits into its target in two passes over
+// chunks of regions.  The first pass computes the amount of live data in each
+// chunk; the destination of each chunk is the prefix sum of these.  The second
+// pass summarizes each chunk starting at its destination.
+class PSParallelSummarizeTask : public AbstractGangTask {
+  ParallelCompactData& _sd;
+  const SplitInfo& _split_info;
+  size_t const _beg_region;
+  size_t const _end_region;
+  uint const _num_chunks;
+
+  // Live words of each chunk in the first pass, destination of each chunk
+  // in the second pass.
+  size_t* _chunk_words;
+  HeapWord** _chunk_destinations;
+  bool _summarize;
+
+  volatile uint _claimed_chunks;
+
+public:
+  // Number of regions below which the summary is computed by a single thread.
+  static const size_t RegionsPerChunk = 1024;
+
+  PSParallelSummarizeTask(ParallelCompactData& sd, const SplitInfo& split_info,
+                          size_t beg_region, size_t end_region) :
+    AbstractGangTask("PSParallelSummarizeTask"),
+    _sd(sd),
+    _split_info(split_info),
+    _beg_region(beg_region),
+    _end_region(end_region),
+    _num_chunks((uint)((end_region - beg_region + RegionsPerChunk - 1) / RegionsPerChunk)),
+    _chunk_words(NEW_C_HEAP_ARRAY(size_t, _num_chunks, mtGC)),
+    _chunk_destinations(NEW_C_HEAP_ARRAY(HeapWord*, _num_chunks, mtGC)),
+    _summarize(false),
+    _claimed_chunks(0) { }
+
+  ~PSParallelSummarizeTask() {
+    FREE_C_HEAP_ARRAY(size_t, _chunk_words);
+    FREE_C_HEAP_ARRAY(HeapWord*, _chunk_destinations);
+  }
+
+  // Switch from the first to the second pass.  Returns the address following
+  // the summarized data.
+  HeapWord* prepare_summarize(HeapWord* target_beg) {
+    assert(!_summarize, "must only be called once");
+    HeapWord* dest_addr = target_beg;
+    for (uint i = 0; i < _num_chunks; i++) {
+      _chunk_destinations[i] = dest_addr;
+      dest_addr += _chunk_words[i];
+    }
+    _summarize = true;
+    _claimed_chunks = 0;
+    return dest_addr;
+  }
+
+  virtual void work(uint worker_id) {
+    for (uint chunk = Atomic::fetch_and_add(&_claimed_chunks, 1u);
+         chunk < _num_chunks;
+         chunk = Atomic::fetch_and_add(&_claimed_chunks, 1u)) {
+      size_t const beg = _beg_region + chunk * RegionsPerChunk;
+      size_t const end = MIN2(beg + RegionsPerChunk, _end_region);
+      if (_summarize) {
+        HeapWord* const next = _sd.summarize_range(_split_info, beg, end, _chunk_destinations[chunk]);
+        assert(chunk + 1 == _num_chunks || next == _chunk_destinations[chunk + 1],
+               "chunk %u summary must end at the destination of the next chunk", chunk);
+      } else {
+        _chunk_words[chunk] = _sd.live_words_in_range(beg, end);
+      }
+    }
+  }
+};
+
+void PSParallelCompact::summarize_par(SplitInfo& split_info,
+                                      HeapWord* source_beg, HeapWord* source_end,
+                                      HeapWord* target_beg, HeapWord* target_end,
+                                      HeapWord** target_next)
+{
+  const size_t beg_region = _summary_data.addr_to_region_idx(source_beg);
+  const size_t end_region = _summary_data.addr_to_region_idx(_summary_data.region_align_up(source_end));
+  WorkGang& workers = ParallelScavengeHeap::heap()->workers();
+
+  if (workers.active_workers() == 1 ||
+      end_region - beg_region <= PSParallelSummarizeTask::RegionsPerChunk) {
+    bool result = _summary_data.summarize(split_info,
+                                          source_beg, source_end, NULL,
+                                          target_beg, target_end, target_next);
+    assert(result, "source must fit into target");
+    return;
+  }
+
+  PSParallelSummarizeTask task(_summary_data, split_info, beg_region, end_region);
+  workers.run_task(&task);
+  *target_next = task.prepare_summarize(target_beg);
+  assert(*target_next <= target_end, "source must fit into target");
+  workers.run_task(&task);
+}
+
 void PSParallelCompact::summarize_spaces_quick()
 {
   for (unsigned int i = 0; i < last_space_id; ++i) {
     const MutableSpace* space = _space_info[i].space();
-    HeapWord** nta = _space_info[i].new_top_addr();
-    bool result = _summary_data.summarize(_space_info[i].split_info(),
-                                          space->bottom(), space->top(), NULL,
-                                          space->bottom(), space->end(), nta);
-    assert(result, "space must fit into itself");
+    summarize_par(_space_info[i].split_info(),
+                  space->bottom(), space->top(),
+                  space->bottom(), space->end(), _space_info[i].new_top_addr());
     _space_info[i].set_dense_prefix(space->bottom());
   }
 }
@@ -1544,10 +1675,10 @@ PSParallelCompact::summarize_space(SpaceId id, bool maximum_compaction)
 
       // Compute the destination of each Region, and thus each object.
       _summary_data.summarize_dense_prefix(space->bottom(), dense_prefix_end);
-      _summary_data.summarize(_space_info[id].split_info(),
-                              dense_prefix_end, space->top(), NULL,
-                              dense_prefix_end, space->end(),
-                              _space_info[id].new_top_addr());
+      summarize_par(_space_info[id].split_info(),
+                    dense_prefix_end, space->top(),
+                    dense_prefix_end, space->end(),
+                    _space_info[id].new_top_addr());
     }
   }
 
@@ -442,6 +442,16 @@ public:
                  HeapWord* target_beg, HeapWord* target_end,
                  HeapWord** target_next);
 
+  // Return the amount of live data in the regions [beg_region, end_region).
+  size_t live_words_in_range(size_t beg_region, size_t end_region) const;
+
+  // Summarize the regions [beg_region, end_region), all of which must fit into
+  // the target starting at dest_addr, and return the address following the
+  // data.  Disjoint ranges may be summarized concurrently.
+  HeapWord* summarize_range(const SplitInfo& split_info,
+                            size_t beg_region, size_t end_region,
+                            HeapWord* dest_addr);
+
   void clear();
   void clear_range(size_t beg_region, size_t end_region);
   void clear_range(HeapWord* beg, HeapWord* end) {
@@ -497,6 +507,11 @@ private:
   bool initialize_region_data(size_t region_size);
   PSVirtualSpace* create_vspace(size_t count, size_t element_size);
 
+  // Set up the destination count and source regions for the non-empty region
+  // cur_region whose data is copied to dest_addr.
+  void summarize_region(const SplitInfo& split_info, size_t cur_region,
+                        HeapWord* dest_addr, size_t words);
+
 private:
   HeapWord*       _region_start;
 #ifdef  ASSERT
@@ -1104,6 +1119,14 @@ class PSParallelCompact : AllStatic {
   // non-empty.
   static void fill_dense_prefix_end(SpaceId id);
 
+  // Summarize the source range into the target range, which must be large
+  // enough to hold all live data of the source.  Large ranges are summarized
+  // by the gc worker threads.
+  static void summarize_par(SplitInfo& split_info,
+                            HeapWord* source_beg, HeapWord* source_end,
+                            HeapWord* target_beg, HeapWord* target_end,
+                            HeapWord** target_next);
+
   static void summarize_spaces_quick();
   static void summarize_space(SpaceId id, bool maximum_compaction);
   static void summary_phase(ParCompactionManager* cm, bool maximum_compaction);
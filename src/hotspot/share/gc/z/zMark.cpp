@@ -360,10 +360,16 @@ bool ZMark::try_steal_local(ZMarkStripe* stripe, ZMarkThreadLocalStacks* stacks)
 }
 
 bool ZMark::try_steal_global(ZMarkStripe* stripe, ZMarkThreadLocalStacks* stacks) {
-  // Try to steal a stack from another stripe
-  for (ZMarkStripe* victim_stripe = _stripes.stripe_next(stripe);
-       victim_stripe != stripe;
-       victim_stripe = _stripes.stripe_next(victim_stripe)) {
+  // Try to steal a stack from another stripe. When there are more workers
+  // than stripes, the workers sharing a stripe start probing at different
+  // victim stripes, so that they don't all contend on the same victim.
+  const size_t nstripes = _stripes.nstripes();
+  const size_t stripe_id = _stripes.stripe_id(stripe);
+  const size_t start = ZThread::worker_id() / nstripes;
+
+  for (size_t i = 0; i < nstripes - 1; i++) {
+    const size_t offset = 1 + ((start + i) % (nstripes - 1));
+    ZMarkStripe* const victim_stripe = _stripes.stripe_at((stripe_id + offset) % nstripes);
     ZMarkStack* const stack = victim_stripe->steal_stack();
     if (stack != NULL) {
       // Success, install the stolen stack
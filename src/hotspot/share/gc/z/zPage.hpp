@@ -77,6 +77,7 @@ public:
 
   bool is_allocating() const;
   bool is_relocatable() const;
+  uint32_t age() const;
 
   uint64_t last_used() const;
   void set_last_used();
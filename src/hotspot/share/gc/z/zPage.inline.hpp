@@ -153,6 +153,11 @@ inline bool ZPage::is_relocatable() const {
   return _seqnum < ZGlobalSeqNum;
 }
 
+inline uint32_t ZPage::age() const {
+  // Number of GC cycles started since the page was allocated
+  return ZGlobalSeqNum - _seqnum;
+}
+
 inline uint64_t ZPage::last_used() const {
   return _last_used;
 }
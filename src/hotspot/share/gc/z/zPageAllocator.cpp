@@ -32,6 +32,7 @@
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAllocator.inline.hpp"
 #include "gc/z/zPageCache.hpp"
+#include "gc/z/zPageRefiller.hpp"
 #include "gc/z/zSafeDelete.inline.hpp"
 #include "gc/z/zStat.hpp"
 #include "gc/z/zTask.hpp"
@@ -148,6 +149,7 @@ ZPageAllocator::ZPageAllocator(ZWorkers* workers,
     _satisfied(),
     _unmapper(new ZUnmapper(this)),
     _uncommitter(new ZUncommitter(this)),
+    _refiller(NULL),
     _safe_delete(),
     _initialized(false) {
 
@@ -177,6 +179,11 @@ ZPageAllocator::ZPageAllocator(ZWorkers* workers,
     return;
   }
 
+  // Start page cache refiller
+  if (ZPageCacheRefill && ZPageSizeMedium > 0) {
+    _refiller = new ZPageRefiller(this);
+  }
+
   // Successfully initialized
   _initialized = true;
 }
@@ -660,6 +667,12 @@ retry:
   event.commit(type, size, allocation.flushed(), allocation.committed(),
                page->physical_memory().nsegments(), flags.non_blocking());
 
+  // Make sure there is a medium page ready for the next medium page
+  // allocation, so that it doesn't have to flush and remap cached pages.
+  if (_refiller != NULL && type == ZPageTypeMedium) {
+    _refiller->request_refill();
+  }
+
   return page;
 }
 
@@ -772,6 +785,60 @@ size_t ZPageAllocator::uncommit(uint64_t* timeout) {
   return flushed;
 }
 
+bool ZPageAllocator::is_refill_allowed(size_t size) const {
+  // Only refill when there is plenty of headroom below the soft max
+  // capacity, so that a refill never competes with mutator allocations.
+  const size_t soft_max_capacity = this->soft_max_capacity();
+  const size_t used = _used + _claimed;
+  return used < soft_max_capacity && soft_max_capacity - used >= size * 2;
+}
+
+void ZPageAllocator::refill() {
+  // Join the suspendible thread set for the whole refill, like a mutator
+  // or worker allocating a page, to make sure GC safepoints will have a
+  // consistent view of capacity, used and the pages being created.
+  SuspendibleThreadSetJoiner joiner;
+
+  ZAllocationFlags flags;
+  flags.set_non_blocking();
+  ZPageAllocation allocation(ZPageTypeMedium, ZPageSizeMedium, flags);
+
+  {
+    ZLocker<ZLock> locker(&_lock);
+
+    // Don't refill while the uncommitter is releasing unused memory, since
+    // that would just commit the same memory again. The refilled page is
+    // briefly counted as used until it's freed into the cache, which is
+    // bounded by is_refill_allowed().
+    if (_cache.has_medium_page() ||
+        _cache.is_uncommit_delayed() ||
+        !_stalled.is_empty() ||
+        !is_refill_allowed(ZPageSizeMedium)) {
+      // Refill not needed or not allowed
+      return;
+    }
+
+    if (!alloc_page_common(&allocation)) {
+      // Out of memory
+      return;
+    }
+  }
+
+  // Commit, flush and remap outside of the allocation path
+  ZPage* const page = alloc_page_finalize(&allocation);
+  if (page == NULL) {
+    // Failed to commit or map, give up until next request
+    alloc_page_failed(&allocation);
+    return;
+  }
+
+  log_debug(gc, heap)("Page Cache Refilled: " SIZE_FORMAT "M (Flushed: " SIZE_FORMAT "M, Committed: " SIZE_FORMAT "M)",
+                      page->size() / M, allocation.flushed() / M, allocation.committed() / M);
+
+  // Insert page into the page cache
+  free_page(page, false /* reclaimed */);
+}
+
 void ZPageAllocator::enable_deferred_delete() const {
   _safe_delete.enable_deferred_delete();
 }
@@ -831,4 +898,7 @@ void ZPageAllocator::check_out_of_memory() {
 void ZPageAllocator::threads_do(ThreadClosure* tc) const {
   tc->do_thread(_unmapper);
   tc->do_thread(_uncommitter);
+  if (_refiller != NULL) {
+    tc->do_thread(_refiller);
+  }
 }
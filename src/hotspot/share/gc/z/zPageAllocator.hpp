@@ -36,12 +36,14 @@
 class ThreadClosure;
 class ZPageAllocation;
 class ZPageAllocatorStats;
+class ZPageRefiller;
 class ZWorkers;
 class ZUncommitter;
 class ZUnmapper;
 
 class ZPageAllocator {
   friend class VMStructs;
+  friend class ZPageRefiller;
   friend class ZUnmapper;
   friend class ZUncommitter;
 
@@ -63,6 +65,7 @@ private:
   ZList<ZPageAllocation>     _satisfied;
   ZUnmapper*                 _unmapper;
   ZUncommitter*              _uncommitter;
+  ZPageRefiller*             _refiller;
   mutable ZSafeDelete<ZPage> _safe_delete;
   bool                       _initialized;
 
@@ -98,6 +101,9 @@ private:
 
   size_t uncommit(uint64_t* timeout);
 
+  bool is_refill_allowed(size_t size) const;
+  void refill();
+
 public:
   ZPageAllocator(ZWorkers* workers,
                  size_t min_capacity,
@@ -58,7 +58,8 @@ ZPageCache::ZPageCache() :
     _small(),
     _medium(),
     _large(),
-    _last_commit(0) {}
+    _last_commit(0),
+    _last_uncommit(0) {}
 
 ZPage* ZPageCache::alloc_small_page() {
   const uint32_t numa_id = ZNUMA::id();
@@ -198,6 +199,18 @@ void ZPageCache::free_page(ZPage* page) {
   }
 }
 
+bool ZPageCache::has_medium_page() const {
+  return !_medium.is_empty();
+}
+
+bool ZPageCache::is_uncommit_delayed() const {
+  // Pages flushed for uncommit were unused for at least ZUncommitDelay,
+  // so until the same delay has passed since then, there is no sign of
+  // demand that would justify committing memory again.
+  const uint64_t now = os::elapsedTime();
+  return _last_uncommit > 0 && _last_uncommit + ZUncommitDelay > now;
+}
+
 bool ZPageCache::flush_list_inner(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to) {
   ZPage* const page = from->last();
   if (page == NULL || !cl->do_page(page)) {
@@ -325,6 +338,10 @@ size_t ZPageCache::flush_for_uncommit(size_t requested, ZList<ZPage>* to, uint64
   ZPageCacheFlushForUncommitClosure cl(requested, now, timeout);
   flush(&cl, to);
 
+  if (cl._flushed > 0) {
+    _last_uncommit = now;
+  }
+
   return cl._flushed;
 }
 
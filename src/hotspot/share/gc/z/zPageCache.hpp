@@ -36,6 +36,7 @@ private:
   ZList<ZPage>            _medium;
   ZList<ZPage>            _large;
   uint64_t                _last_commit;
+  uint64_t                _last_uncommit;
 
   ZPage* alloc_small_page();
   ZPage* alloc_medium_page();
@@ -56,6 +57,9 @@ public:
   ZPage* alloc_page(uint8_t type, size_t size);
   void free_page(ZPage* page);
 
+  bool has_medium_page() const;
+  bool is_uncommit_delayed() const;
+
   void flush_for_allocation(size_t requested, ZList<ZPage>* to);
   size_t flush_for_uncommit(size_t requested, ZList<ZPage>* to, uint64_t* timeout);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -21,26 +21,46 @@
  * questions.
  */
 
-package gc.g1;
+#include "precompiled.hpp"
+#include "gc/z/zLock.inline.hpp"
+#include "gc/z/zPageAllocator.hpp"
+#include "gc/z/zPageRefiller.hpp"
 
-/**
- * @test TestShrinkAuxiliaryData10
- * @key randomness
- * @bug 8038423 8061715 8078405
- * @summary Checks that decommitment occurs for JVM with different
- * G1ConcRSLogCacheSize and ObjectAlignmentInBytes options values
- * @requires vm.gc.G1
- * @library /test/lib
- * @library /
- * @modules java.base/jdk.internal.misc
- *          java.management
- * @build sun.hotspot.WhiteBox
- * @run driver jdk.test.lib.helpers.ClassFileInstaller sun.hotspot.WhiteBox
- * @run main/timeout=720 gc.g1.TestShrinkAuxiliaryData10
- */
-public class TestShrinkAuxiliaryData10 {
+ZPageRefiller::ZPageRefiller(ZPageAllocator* page_allocator) :
+    _page_allocator(page_allocator),
+    _lock(),
+    _requested(false),
+    _stop(false) {
+  set_name("ZPageRefiller");
+  create_and_start();
+}
+
+bool ZPageRefiller::wait() {
+  ZLocker<ZConditionLock> locker(&_lock);
+  while (!_requested && !_stop) {
+    _lock.wait();
+  }
+
+  _requested = false;
+  return !_stop;
+}
+
+void ZPageRefiller::request_refill() {
+  ZLocker<ZConditionLock> locker(&_lock);
+  if (!_requested) {
+    _requested = true;
+    _lock.notify_all();
+  }
+}
+
+void ZPageRefiller::run_service() {
+  while (wait()) {
+    _page_allocator->refill();
+  }
+}
 
-    public static void main(String[] args) throws Exception {
-        new TestShrinkAuxiliaryData(10).test();
-    }
+void ZPageRefiller::stop_service() {
+  ZLocker<ZConditionLock> locker(&_lock);
+  _stop = true;
+  _lock.notify_all();
 }
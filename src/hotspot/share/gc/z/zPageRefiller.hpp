@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -21,27 +21,31 @@
  * questions.
  */
 
-package gc.g1;
+#ifndef SHARE_GC_Z_ZPAGEREFILLER_HPP
+#define SHARE_GC_Z_ZPAGEREFILLER_HPP
 
-/*
- * @test TestNoUseHCC
- * @summary Check that G1 survives a GC without HCC enabled
- * @requires vm.gc.G1
- * @modules java.base/jdk.internal.misc
- * @library /test/lib
- * @build sun.hotspot.WhiteBox
- * @run driver jdk.test.lib.helpers.ClassFileInstaller sun.hotspot.WhiteBox
- * @run main/othervm -Xbootclasspath/a:. -Xlog:gc+phases=debug -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI -XX:+UseG1GC -Xmx64M -XX:G1ConcRSLogCacheSize=0 gc.g1.TestNoUseHCC
- */
+#include "gc/shared/concurrentGCThread.hpp"
+#include "gc/z/zLock.hpp"
+
+class ZPageAllocator;
+
+class ZPageRefiller : public ConcurrentGCThread {
+private:
+  ZPageAllocator* const _page_allocator;
+  ZConditionLock        _lock;
+  bool                  _requested;
+  bool                  _stop;
 
-import sun.hotspot.WhiteBox;
+  bool wait();
 
-public class TestNoUseHCC {
+protected:
+  virtual void run_service();
+  virtual void stop_service();
 
-    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+public:
+  ZPageRefiller(ZPageAllocator* page_allocator);
 
-    public static void main(String [] args) {
-        WB.youngGC();
-    }
-}
+  void request_refill();
+};
 
+#endif // SHARE_GC_Z_ZPAGEREFILLER_HPP
@@ -25,6 +25,7 @@
 #include "gc/shared/gc_globals.hpp"
 #include "gc/z/zArray.inline.hpp"
 #include "gc/z/zForwarding.inline.hpp"
+#include "gc/z/zHeap.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zRelocationSetSelector.inline.hpp"
 #include "jfr/jfrEvents.hpp"
@@ -63,6 +64,44 @@ bool ZRelocationSetSelectorGroup::is_selectable() {
   return _page_type != ZPageTypeLarge;
 }
 
+bool ZRelocationSetSelectorGroup::is_deferrable(const ZPage* page) const {
+  // Young pages with little live data are cheap to relocate right away,
+  // which reclaims most of the page now instead of one GC cycle later.
+  return page->age() == 1 && page->live_bytes() >= _fragmentation_limit;
+}
+
+size_t ZRelocationSetSelectorGroup::deferrable_garbage() const {
+  size_t garbage = 0;
+
+  ZArrayIterator<ZPage*> iter(&_live_pages);
+  for (ZPage* page; iter.next(&page);) {
+    if (is_deferrable(page)) {
+      garbage += page->size() - page->live_bytes();
+    }
+  }
+
+  return garbage;
+}
+
+void ZRelocationSetSelectorGroup::defer_young_pages() {
+  // Remove deferrable young pages from the candidate pages. They are left
+  // in place for one more GC cycle, hoping that most of their objects die
+  // by then.
+  const int npages = _live_pages.length();
+  int nkept = 0;
+
+  for (int i = 0; i < npages; i++) {
+    ZPage* const page = _live_pages.at(i);
+    if (!is_deferrable(page)) {
+      _live_pages.at_put(nkept++, page);
+    }
+  }
+
+  _live_pages.trunc_to(nkept);
+
+  log_debug(gc, reloc)("Deferred Young Pages (%s Pages): %d", _name, npages - nkept);
+}
+
 void ZRelocationSetSelectorGroup::semi_sort() {
   // Semi-sort live pages by number of live bytes in ascending order
   const size_t npartitions_shift = 11;
@@ -161,7 +200,7 @@ void ZRelocationSetSelectorGroup::select_inner() {
                        _name, selected_from, selected_to, npages - selected_from, selected_forwarding_entries);
 }
 
-void ZRelocationSetSelectorGroup::select() {
+void ZRelocationSetSelectorGroup::select(bool defer_young) {
   if (is_disabled()) {
     return;
   }
@@ -169,6 +208,10 @@ void ZRelocationSetSelectorGroup::select() {
   EventZRelocationSetGroup event;
 
   if (is_selectable()) {
+    if (defer_young) {
+      defer_young_pages();
+    }
+
     select_inner();
   }
 
@@ -176,11 +219,63 @@ void ZRelocationSetSelectorGroup::select() {
   event.commit(_page_type, _stats.npages(), _stats.total(), _stats.empty(), _stats.relocate());
 }
 
+size_t ZRelocationSetSelectorGroup::selected_young_live() const {
+  size_t live = 0;
+
+  ZArrayIterator<ZPage*> iter(&_live_pages);
+  for (ZPage* page; iter.next(&page);) {
+    if (page->age() == 1) {
+      live += page->live_bytes();
+    }
+  }
+
+  return live;
+}
+
+size_t ZRelocationSetSelector::_young_live_last = 0;
+
 ZRelocationSetSelector::ZRelocationSetSelector() :
     _small("Small", ZPageTypeSmall, ZPageSizeSmall, ZObjectSizeLimitSmall),
     _medium("Medium", ZPageTypeMedium, ZPageSizeMedium, ZObjectSizeLimitMedium),
     _large("Large", ZPageTypeLarge, 0 /* page_size */, 0 /* object_size_limit */),
-    _empty_pages() {}
+    _empty_pages(),
+    _young_live(0),
+    _aged_live(0) {}
+
+bool ZRelocationSetSelector::should_defer_young_pages(size_t used, size_t soft_max_capacity) const {
+  if (!ZRelocationDeferYoungPages || _young_live_last == 0) {
+    // Disabled, or no history to base a prediction on
+    return false;
+  }
+
+  // Deferred pages hold on to their garbage for one more GC cycle. Only
+  // defer while that garbage takes at most a quarter of the headroom left
+  // below the soft max capacity, so that deferral doesn't make allocation
+  // stalls more likely.
+  const size_t garbage = _small.deferrable_garbage() + _medium.deferrable_garbage();
+  const size_t headroom = soft_max_capacity - MIN2(used, soft_max_capacity);
+  if (garbage > headroom / 4) {
+    log_debug(gc, reloc)("Young Page Survival: Not Deferring, Insufficient Headroom (" SIZE_FORMAT "M garbage, " SIZE_FORMAT "M headroom)",
+                         garbage / M, headroom / M);
+    return false;
+  }
+
+  // The live bytes in aged pages are what remains of the live bytes that
+  // were left in young pages by the last selection. Use that survival rate
+  // to predict how much of the live bytes in the current young pages will
+  // survive another GC cycle. Young pages are only deferred if less than
+  // half is predicted to survive, in which case relocating them in the next
+  // GC cycle is expected to be at least twice as cheap. Deferred pages are
+  // never deferred again, since they will no longer be young.
+  const double survival = percent_of(_aged_live, _young_live_last);
+  const bool defer = survival < 50.0;
+
+  log_debug(gc, reloc)("Young Page Survival: %.1f%% (" SIZE_FORMAT "M->" SIZE_FORMAT "M), %s",
+                       survival, _young_live_last / M, _aged_live / M,
+                       defer ? "Deferring" : "Not Deferring");
+
+  return defer;
+}
 
 void ZRelocationSetSelector::select() {
   // Select pages to relocate. The resulting relocation set will be
@@ -191,10 +286,17 @@ void ZRelocationSetSelector::select() {
 
   EventZRelocationSet event;
 
+  const bool defer_young = should_defer_young_pages(ZHeap::heap()->used(), ZHeap::heap()->soft_max_capacity());
+
   // Select pages from each group
-  _large.select();
-  _medium.select();
-  _small.select();
+  _large.select(defer_young);
+  _medium.select(defer_young);
+  _small.select(defer_young);
+
+  // Record the live bytes left in place in young pages, which will
+  // be aged pages when the next relocation set is selected.
+  const size_t selected_young_live = _small.selected_young_live() + _medium.selected_young_live();
+  _young_live_last = _young_live - selected_young_live;
 
   // Send event
   event.commit(total(), empty(), relocate());
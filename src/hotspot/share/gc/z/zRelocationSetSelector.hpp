@@ -64,6 +64,8 @@ public:
 };
 
 class ZRelocationSetSelectorGroup {
+  friend class ZRelocationSetSelectorTest;
+
 private:
   const char* const                _name;
   const uint8_t                    _page_type;
@@ -76,6 +78,8 @@ private:
 
   bool is_disabled();
   bool is_selectable();
+  bool is_deferrable(const ZPage* page) const;
+  void defer_young_pages();
   void semi_sort();
   void select_inner();
 
@@ -87,20 +91,31 @@ public:
 
   void register_live_page(ZPage* page);
   void register_empty_page(ZPage* page);
-  void select();
+  void select(bool defer_young);
 
   const ZArray<ZPage*>* selected() const;
+  size_t selected_young_live() const;
+  size_t deferrable_garbage() const;
   size_t forwarding_entries() const;
 
   const ZRelocationSetSelectorGroupStats& stats() const;
 };
 
 class ZRelocationSetSelector : public StackObj {
+  friend class ZRelocationSetSelectorTest;
+
 private:
+  static size_t               _young_live_last;
+
   ZRelocationSetSelectorGroup _small;
   ZRelocationSetSelectorGroup _medium;
   ZRelocationSetSelectorGroup _large;
   ZArray<ZPage*>              _empty_pages;
+  size_t                      _young_live;
+  size_t                      _aged_live;
+
+  void register_age(ZPage* page);
+  bool should_defer_young_pages(size_t used, size_t soft_max_capacity) const;
 
   size_t total() const;
   size_t empty() const;
@@ -96,13 +96,26 @@ inline const ZRelocationSetSelectorGroupStats& ZRelocationSetSelectorGroup::stat
   return _stats;
 }
 
+inline void ZRelocationSetSelector::register_age(ZPage* page) {
+  // Young pages were allocated during the last GC cycle. Aged pages were
+  // young during the last GC cycle, and were then not relocated.
+  const uint32_t age = page->age();
+  if (age == 1) {
+    _young_live += page->live_bytes();
+  } else if (age == 2) {
+    _aged_live += page->live_bytes();
+  }
+}
+
 inline void ZRelocationSetSelector::register_live_page(ZPage* page) {
   const uint8_t type = page->type();
 
   if (type == ZPageTypeSmall) {
     _small.register_live_page(page);
+    register_age(page);
   } else if (type == ZPageTypeMedium) {
     _medium.register_live_page(page);
+    register_age(page);
   } else {
     _large.register_live_page(page);
   }
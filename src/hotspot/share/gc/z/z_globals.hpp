@@ -48,6 +48,10 @@
   product(bool, ZProactive, true,                                           \
           "Enable proactive GC cycles")                                     \
                                                                             \
+  product(bool, ZRelocationDeferYoungPages, false, EXPERIMENTAL,            \
+          "Defer relocation of pages allocated during the last GC cycle "   \
+          "when their live data is predicted to die before the next cycle") \
+                                                                            \
   product(bool, ZUncommit, true,                                            \
           "Uncommit unused memory")                                         \
                                                                             \
@@ -55,6 +59,11 @@
           "Uncommit memory if it has been unused for the specified "        \
           "amount of time (in seconds)")                                    \
                                                                             \
+  product(bool, ZPageCacheRefill, false, EXPERIMENTAL,                      \
+          "Keep a mapped medium page in the page cache, refilled by a "     \
+          "background thread, so that medium page allocations rarely "      \
+          "need to flush and remap cached pages")                           \
+                                                                            \
   product(uint, ZStatisticsInterval, 10, DIAGNOSTIC,                        \
           "Time between statistics print outs (in seconds)")                \
           range(1, (uint)-1)                                                \
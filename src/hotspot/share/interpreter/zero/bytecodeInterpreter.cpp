@@ -287,6 +287,18 @@
 #endif /* PREFETCH_OPCCODE */
 #endif /* USELABELS */
 
+/*
+ * REWRITE_AT_PC - Macro for replacing the current bytecode with its
+ * quickened form. A bytecode that is executed on behalf of a breakpoint
+ * is not the one stored at pc, and is left alone.
+ */
+#undef REWRITE_AT_PC
+#define REWRITE_AT_PC(val) {                    \
+        if (RewriteBytecodes && *pc == opcode) { \
+          *pc = (val);                          \
+        }                                       \
+    }
+
 // About to call a new method, update the save the adjusted pc and return to frame manager
 #define UPDATE_PC_AND_RETURN(opsize)  \
    DECACHE_TOS();                     \
@@ -509,19 +521,19 @@ void BytecodeInterpreter::run(interpreterState istate) {
 
 /* 0xC0 */ &&opc_checkcast,   &&opc_instanceof,     &&opc_monitorenter, &&opc_monitorexit,
 /* 0xC4 */ &&opc_wide,        &&opc_multianewarray, &&opc_ifnull,       &&opc_ifnonnull,
-/* 0xC8 */ &&opc_goto_w,      &&opc_jsr_w,          &&opc_breakpoint,   &&opc_default,
-/* 0xCC */ &&opc_default,     &&opc_default,        &&opc_default,      &&opc_default,
+/* 0xC8 */ &&opc_goto_w,         &&opc_jsr_w,          &&opc_breakpoint,     &&opc_fast_agetfield,
+/* 0xCC */ &&opc_fast_bgetfield, &&opc_fast_cgetfield, &&opc_fast_dgetfield, &&opc_fast_fgetfield,
 
-/* 0xD0 */ &&opc_default,     &&opc_default,        &&opc_default,      &&opc_default,
-/* 0xD4 */ &&opc_default,     &&opc_default,        &&opc_default,      &&opc_default,
-/* 0xD8 */ &&opc_default,     &&opc_default,        &&opc_default,      &&opc_default,
-/* 0xDC */ &&opc_default,     &&opc_default,        &&opc_default,      &&opc_default,
+/* 0xD0 */ &&opc_fast_igetfield, &&opc_fast_lgetfield, &&opc_fast_sgetfield, &&opc_fast_aputfield,
+/* 0xD4 */ &&opc_fast_bputfield, &&opc_fast_zputfield, &&opc_fast_cputfield, &&opc_fast_dputfield,
+/* 0xD8 */ &&opc_fast_fputfield, &&opc_fast_iputfield, &&opc_fast_lputfield, &&opc_fast_sputfield,
+/* 0xDC */ &&opc_fast_aload_0,   &&opc_fast_iaccess_0, &&opc_fast_aaccess_0, &&opc_fast_faccess_0,
 
-/* 0xE0 */ &&opc_default,     &&opc_default,        &&opc_default,         &&opc_default,
+/* 0xE0 */ &&opc_fast_iload,     &&opc_fast_iload2,    &&opc_fast_icaload,   &&opc_default,
 /* 0xE4 */ &&opc_default,     &&opc_default,        &&opc_fast_aldc,    &&opc_fast_aldc_w,
 /* 0xE8 */ &&opc_return_register_finalizer,
-                              &&opc_invokehandle,   &&opc_default,      &&opc_default,
-/* 0xEC */ &&opc_default,     &&opc_default,        &&opc_default,         &&opc_default,
+                              &&opc_invokehandle,   &&opc_nofast_getfield, &&opc_nofast_putfield,
+/* 0xEC */ &&opc_nofast_aload_0, &&opc_nofast_iload, &&opc_default,        &&opc_default,
 
 /* 0xF0 */ &&opc_default,     &&opc_default,        &&opc_default,      &&opc_default,
 /* 0xF4 */ &&opc_default,     &&opc_default,        &&opc_default,      &&opc_default,
@@ -789,10 +801,45 @@ run:
           UPDATE_PC_AND_TOS_AND_CONTINUE(2, 1);
 
       CASE(_iload):
+          if (RewriteFrequentPairs) {
+            // Wait for a following iload to be quickened before pairing
+            switch (pc[2]) {
+              case Bytecodes::_iload:                                            break;
+              case Bytecodes::_fast_iload: REWRITE_AT_PC(Bytecodes::_fast_iload2);  break;
+              case Bytecodes::_caload:     REWRITE_AT_PC(Bytecodes::_fast_icaload); break;
+              default:                     REWRITE_AT_PC(Bytecodes::_fast_iload);   break;
+            }
+          }
+          SET_STACK_SLOT(LOCALS_SLOT(pc[1]), 0);
+          UPDATE_PC_AND_TOS_AND_CONTINUE(2, 1);
+
+      CASE(_fast_iload):
       CASE(_fload):
           SET_STACK_SLOT(LOCALS_SLOT(pc[1]), 0);
           UPDATE_PC_AND_TOS_AND_CONTINUE(2, 1);
 
+      CASE(_fast_iload2):
+          SET_STACK_SLOT(LOCALS_SLOT(pc[1]), 0);
+          if (JVMTI_ENABLED) {
+            // Step through the second iload on its own
+            UPDATE_PC_AND_TOS_AND_CONTINUE(2, 1);
+          }
+          SET_STACK_SLOT(LOCALS_SLOT(pc[3]), 1);
+          UPDATE_PC_AND_TOS_AND_CONTINUE(4, 2);
+
+      CASE(_fast_icaload): {
+          jint index = LOCALS_INT(pc[1]);
+          arrayOop arrObj = (arrayOop)STACK_OBJECT(-1);
+          if (JVMTI_ENABLED || arrObj == NULL ||
+              (uint32_t)index >= (uint32_t)arrObj->length()) {
+            // Let the caload report events and exceptions at its own bci
+            SET_STACK_INT(index, 0);
+            UPDATE_PC_AND_TOS_AND_CONTINUE(2, 1);
+          }
+          SET_STACK_INT(*(jchar *)(((address) arrObj->base(T_CHAR)) + index * sizeof(jchar)), -1);
+          UPDATE_PC_AND_CONTINUE(3);
+      }
+
       CASE(_lload):
           SET_STACK_LONG_FROM_ADDR(LOCALS_LONG_AT(pc[1]), 1);
           UPDATE_PC_AND_TOS_AND_CONTINUE(2, 2);
@@ -801,13 +848,67 @@ run:
           SET_STACK_DOUBLE_FROM_ADDR(LOCALS_DOUBLE_AT(pc[1]), 1);
           UPDATE_PC_AND_TOS_AND_CONTINUE(2, 2);
 
-#undef  OPC_LOAD_n
-#define OPC_LOAD_n(num)                                                 \
+      CASE(_aload_0):
+          if (RewriteFrequentPairs) {
+            // Wait for a following getfield to be quickened before pairing
+            switch (pc[1]) {
+              case Bytecodes::_getfield:                                              break;
+              case Bytecodes::_fast_igetfield: REWRITE_AT_PC(Bytecodes::_fast_iaccess_0); break;
+              case Bytecodes::_fast_agetfield: REWRITE_AT_PC(Bytecodes::_fast_aaccess_0); break;
+              case Bytecodes::_fast_fgetfield: REWRITE_AT_PC(Bytecodes::_fast_faccess_0); break;
+              default:                         REWRITE_AT_PC(Bytecodes::_fast_aload_0);   break;
+            }
+          }
+          VERIFY_OOP(LOCALS_OBJECT(0));
+          SET_STACK_OBJECT(LOCALS_OBJECT(0), 0);
+          UPDATE_PC_AND_TOS_AND_CONTINUE(1, 1);
+
+      CASE(_fast_aload_0):
+          VERIFY_OOP(LOCALS_OBJECT(0));
+          SET_STACK_OBJECT(LOCALS_OBJECT(0), 0);
+          UPDATE_PC_AND_TOS_AND_CONTINUE(1, 1);
+
+#undef  OPC_FAST_ACCESS_0
+#define OPC_FAST_ACCESS_0(opcname, stack_type, field_type)                 \
+      CASE(_fast_##opcname##access_0): {                                    \
+          oop obj = LOCALS_OBJECT(0);                                       \
+          VERIFY_OOP(obj);                                                  \
+          SET_STACK_OBJECT(obj, 0);                                         \
+          if (JVMTI_ENABLED || obj == NULL) {                               \
+            /* Let the getfield report events and exceptions at its bci */  \
+            UPDATE_PC_AND_TOS_AND_CONTINUE(1, 1);                           \
+          }                                                                 \
+          ConstantPoolCacheEntry* cache = cp->entry_at(Bytes::get_native_u2(pc+2)); \
+          OrderAccess::loadload();                                          \
+          int field_offset = cache->f2_as_index();                          \
+          if (cache->is_volatile()) {                                       \
+            if (support_IRIW_for_not_multiple_copy_atomic_cpu) {            \
+              OrderAccess::fence();                                         \
+            }                                                               \
+            SET_STACK_##stack_type(obj->field_type##_field_acquire(field_offset), 0); \
+          } else {                                                          \
+            SET_STACK_##stack_type(obj->field_type##_field(field_offset), 0); \
+          }                                                                 \
+          UPDATE_PC_AND_TOS_AND_CONTINUE(4, 1);                             \
+      }
+
+          OPC_FAST_ACCESS_0(i, INT,    int);
+          OPC_FAST_ACCESS_0(a, OBJECT, obj);
+          OPC_FAST_ACCESS_0(f, FLOAT,  float);
+
+#undef  OPC_ALOAD_n
+#define OPC_ALOAD_n(num)                                                \
       CASE(_aload_##num):                                               \
           VERIFY_OOP(LOCALS_OBJECT(num));                               \
           SET_STACK_OBJECT(LOCALS_OBJECT(num), 0);                      \
-          UPDATE_PC_AND_TOS_AND_CONTINUE(1, 1);                         \
-                                                                        \
+          UPDATE_PC_AND_TOS_AND_CONTINUE(1, 1);
+
+          OPC_ALOAD_n(1);
+          OPC_ALOAD_n(2);
+          OPC_ALOAD_n(3);
+
+#undef  OPC_LOAD_n
+#define OPC_LOAD_n(num)                                                 \
       CASE(_iload_##num):                                               \
       CASE(_fload_##num):                                               \
           SET_STACK_SLOT(LOCALS_SLOT(num), 0);                          \
@@ -1632,6 +1733,21 @@ run:
           //
           TosState tos_type = cache->flag_state();
           int field_offset = cache->f2_as_index();
+          if ((Bytecodes::Code)opcode == Bytecodes::_getfield) {
+            switch (tos_type) {
+              case btos:
+              case ztos: REWRITE_AT_PC(Bytecodes::_fast_bgetfield); break;
+              case ctos: REWRITE_AT_PC(Bytecodes::_fast_cgetfield); break;
+              case stos: REWRITE_AT_PC(Bytecodes::_fast_sgetfield); break;
+              case itos: REWRITE_AT_PC(Bytecodes::_fast_igetfield); break;
+              case ftos: REWRITE_AT_PC(Bytecodes::_fast_fgetfield); break;
+              case ltos: REWRITE_AT_PC(Bytecodes::_fast_lgetfield); break;
+              case dtos: REWRITE_AT_PC(Bytecodes::_fast_dgetfield); break;
+              case atos: REWRITE_AT_PC(Bytecodes::_fast_agetfield); break;
+              default:
+                ShouldNotReachHere();
+            }
+          }
           if (cache->is_volatile()) {
             if (support_IRIW_for_not_multiple_copy_atomic_cpu) {
               OrderAccess::fence();
@@ -1772,6 +1888,24 @@ run:
           // Now store the result
           //
           int field_offset = cache->f2_as_index();
+          // A putfield to a final field outside of its initializer leaves
+          // put_code unset, so it must keep going through the resolver.
+          if ((Bytecodes::Code)opcode == Bytecodes::_putfield &&
+              cache->is_resolved(Bytecodes::_putfield)) {
+            switch (tos_type) {
+              case btos: REWRITE_AT_PC(Bytecodes::_fast_bputfield); break;
+              case ztos: REWRITE_AT_PC(Bytecodes::_fast_zputfield); break;
+              case ctos: REWRITE_AT_PC(Bytecodes::_fast_cputfield); break;
+              case stos: REWRITE_AT_PC(Bytecodes::_fast_sputfield); break;
+              case itos: REWRITE_AT_PC(Bytecodes::_fast_iputfield); break;
+              case ftos: REWRITE_AT_PC(Bytecodes::_fast_fputfield); break;
+              case ltos: REWRITE_AT_PC(Bytecodes::_fast_lputfield); break;
+              case dtos: REWRITE_AT_PC(Bytecodes::_fast_dputfield); break;
+              case atos: REWRITE_AT_PC(Bytecodes::_fast_aputfield); break;
+              default:
+                ShouldNotReachHere();
+            }
+          }
           if (cache->is_volatile()) {
             switch (tos_type) {
               case ztos:
@@ -1848,6 +1982,95 @@ run:
           UPDATE_PC_AND_TOS_AND_CONTINUE(3, count);
         }
 
+      /* Quickened field accesses. The field is resolved and its type is
+       * encoded in the bytecode, so only the offset and volatility are read
+       * from the cache entry.
+       */
+
+#undef  FAST_FIELD_INTRO
+#define FAST_FIELD_INTRO(cpIndexOff)                                             \
+      ConstantPoolCacheEntry* cache = cp->entry_at(Bytes::get_native_u2(pc+(cpIndexOff))); \
+      /* Must not see the entry older than the bytecode that says it is resolved */ \
+      OrderAccess::loadload();                                                   \
+      int field_offset = cache->f2_as_index();
+
+#undef  OPC_FAST_GETFIELD
+#define OPC_FAST_GETFIELD(opcname, stack_type, field_type, stackOff, stackAdj)     \
+      CASE(_fast_##opcname##getfield): {                                         \
+          FAST_FIELD_INTRO(1);                                                   \
+          if (JVMTI_ENABLED &&                                                   \
+              *(int *)JvmtiExport::get_field_access_count_addr() > 0) {          \
+            CALL_VM(InterpreterRuntime::post_field_access(THREAD,                \
+                                        STACK_OBJECT(-1), cache),                \
+                                        handle_exception);                       \
+          }                                                                      \
+          oop obj = STACK_OBJECT(-1);                                            \
+          CHECK_NULL(obj);                                                       \
+          if (cache->is_volatile()) {                                            \
+            if (support_IRIW_for_not_multiple_copy_atomic_cpu) {                 \
+              OrderAccess::fence();                                              \
+            }                                                                    \
+            SET_STACK_##stack_type(obj->field_type##_field_acquire(field_offset), stackOff); \
+          } else {                                                               \
+            SET_STACK_##stack_type(obj->field_type##_field(field_offset), stackOff); \
+          }                                                                      \
+          VERIFY_STACK_##stack_type(stackOff);                                   \
+          UPDATE_PC_AND_TOS_AND_CONTINUE(3, stackAdj);                           \
+      }
+
+#undef  VERIFY_STACK_INT
+#undef  VERIFY_STACK_FLOAT
+#undef  VERIFY_STACK_LONG
+#undef  VERIFY_STACK_DOUBLE
+#undef  VERIFY_STACK_OBJECT
+#define VERIFY_STACK_INT(off)
+#define VERIFY_STACK_FLOAT(off)
+#define VERIFY_STACK_LONG(off)
+#define VERIFY_STACK_DOUBLE(off)
+#define VERIFY_STACK_OBJECT(off) VERIFY_OOP(STACK_OBJECT(off))
+
+          OPC_FAST_GETFIELD(a, OBJECT, obj,    -1, 0);
+          OPC_FAST_GETFIELD(b, INT,    byte,   -1, 0);
+          OPC_FAST_GETFIELD(c, INT,    char,   -1, 0);
+          OPC_FAST_GETFIELD(s, INT,    short,  -1, 0);
+          OPC_FAST_GETFIELD(i, INT,    int,    -1, 0);
+          OPC_FAST_GETFIELD(f, FLOAT,  float,  -1, 0);
+          OPC_FAST_GETFIELD(l, LONG,   long,    0, 1);
+          OPC_FAST_GETFIELD(d, DOUBLE, double,  0, 1);
+
+#undef  OPC_FAST_PUTFIELD
+#define OPC_FAST_PUTFIELD(opcname, stack_type, field_type, slots, mask)          \
+      CASE(_fast_##opcname##putfield): {                                         \
+          FAST_FIELD_INTRO(1);                                                   \
+          if (JVMTI_ENABLED &&                                                   \
+              *(int *)JvmtiExport::get_field_modification_count_addr() > 0) {    \
+            CALL_VM(InterpreterRuntime::post_field_modification(THREAD,          \
+                                        STACK_OBJECT(-(slots) - 1), cache,       \
+                                        (jvalue *)STACK_SLOT(-1)),               \
+                                        handle_exception);                       \
+          }                                                                      \
+          oop obj = STACK_OBJECT(-(slots) - 1);                                  \
+          CHECK_NULL(obj);                                                       \
+          VERIFY_STACK_##stack_type(-1);                                         \
+          if (cache->is_volatile()) {                                            \
+            obj->release_##field_type##_field_put(field_offset, STACK_##stack_type(-1) mask); \
+            OrderAccess::storeload();                                            \
+          } else {                                                               \
+            obj->field_type##_field_put(field_offset, STACK_##stack_type(-1) mask); \
+          }                                                                      \
+          UPDATE_PC_AND_TOS_AND_CONTINUE(3, -(slots) - 1);                       \
+      }
+
+          OPC_FAST_PUTFIELD(a, OBJECT, obj,    1, );
+          OPC_FAST_PUTFIELD(b, INT,    byte,   1, );
+          OPC_FAST_PUTFIELD(z, INT,    byte,   1, & 1); // only store LSB
+          OPC_FAST_PUTFIELD(c, INT,    char,   1, );
+          OPC_FAST_PUTFIELD(s, INT,    short,  1, );
+          OPC_FAST_PUTFIELD(i, INT,    int,    1, );
+          OPC_FAST_PUTFIELD(f, FLOAT,  float,  1, );
+          OPC_FAST_PUTFIELD(l, LONG,   long,   2, );
+          OPC_FAST_PUTFIELD(d, DOUBLE, double, 2, );
+
       CASE(_new): {
         u2 index = Bytes::get_Java_u2(pc+1);
 
@@ -2461,6 +2684,17 @@ run:
           goto opcode_switch;
       }
 
+      /* CDS marks bytecodes in archived methods that must not be rewritten */
+
+      CASE(_nofast_getfield):
+      CASE(_nofast_putfield):
+      CASE(_nofast_aload_0):
+      CASE(_nofast_iload):
+          // The original bytecode runs without quickening, as the one
+          // stored at pc differs from it
+          opcode = (jubyte)Bytecodes::java_code((Bytecodes::Code)opcode);
+          goto opcode_switch;
+
       DEFAULT:
           fatal("Unimplemented opcode %d = %s", opcode,
                 Bytecodes::name((Bytecodes::Code)opcode));
@@ -70,6 +70,13 @@ void ZeroInterpreterGenerator::generate_all() {
     method_entry(native);
     method_entry(native_synchronized);
     Interpreter::_native_entry_end = Interpreter::code()->code_end();
+
+    if (UseCRC32Intrinsics) {
+      ZeroInterpreter::generate_crc32_table();
+    }
+    method_entry(java_util_zip_CRC32_update);
+    method_entry(java_util_zip_CRC32_updateBytes);
+    method_entry(java_util_zip_CRC32_updateByteBuffer);
   }
 
 #undef method_entry
@@ -106,6 +113,12 @@ address ZeroInterpreterGenerator::generate_method_entry(
   case Interpreter::java_lang_math_fmaF    : entry_point = generate_math_entry(kind);      break;
   case Interpreter::java_lang_ref_reference_get
                                            : entry_point = generate_Reference_get_entry(); break;
+  case Interpreter::java_util_zip_CRC32_update
+                                           : native = true; entry_point = generate_CRC32_update_entry();  break;
+  case Interpreter::java_util_zip_CRC32_updateBytes
+                                           : // fall thru
+  case Interpreter::java_util_zip_CRC32_updateByteBuffer
+                                           : native = true; entry_point = generate_CRC32_updateBytes_entry(kind); break;
   default:
     fatal("unexpected method kind: %d", kind);
     break;
@@ -138,11 +151,29 @@ address ZeroInterpreterGenerator::generate_slow_signature_handler() {
 
 address ZeroInterpreterGenerator::generate_math_entry(
     AbstractInterpreter::MethodKind kind) {
-  if (!InlineIntrinsics)
+  if (!UseFastMathMethods)
     return NULL;
 
-  Unimplemented();
-  return NULL;
+  return generate_entry((address) ZeroInterpreter::math_entry);
+}
+
+address ZeroInterpreterGenerator::generate_CRC32_update_entry() {
+  if (!UseCRC32Intrinsics)
+    return NULL;
+
+  return generate_entry((address) ZeroInterpreter::CRC32_update_entry);
+}
+
+address ZeroInterpreterGenerator::generate_CRC32_updateBytes_entry(
+    AbstractInterpreter::MethodKind kind) {
+  if (!UseCRC32Intrinsics)
+    return NULL;
+
+  if (kind == Interpreter::java_util_zip_CRC32_updateBytes) {
+    return generate_entry((address) ZeroInterpreter::CRC32_updateBytes_entry);
+  } else {
+    return generate_entry((address) ZeroInterpreter::CRC32_updateByteBuffer_entry);
+  }
 }
 
 address ZeroInterpreterGenerator::generate_abstract_entry() {
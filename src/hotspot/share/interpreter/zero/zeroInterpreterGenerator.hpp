@@ -47,6 +47,8 @@ class ZeroInterpreterGenerator: public AbstractInterpreterGenerator {
   address generate_getter_entry();
   address generate_setter_entry();
   address generate_Reference_get_entry();
+  address generate_CRC32_update_entry();
+  address generate_CRC32_updateBytes_entry(AbstractInterpreter::MethodKind kind);
 
  public:
   ZeroInterpreterGenerator(StubQueue* _code);
@@ -22,12 +22,13 @@
  *
  */
 #include "precompiled.hpp"
-#include "jfr/leakprofiler/chains/bitset.inline.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "jfr/leakprofiler/chains/bfsClosure.hpp"
 #include "jfr/leakprofiler/chains/dfsClosure.hpp"
 #include "jfr/leakprofiler/chains/edge.hpp"
 #include "jfr/leakprofiler/chains/edgeStore.hpp"
 #include "jfr/leakprofiler/chains/edgeQueue.hpp"
+#include "jfr/leakprofiler/chains/jfrbitset.hpp"
 #include "jfr/leakprofiler/utilities/granularTimer.hpp"
 #include "jfr/leakprofiler/utilities/unifiedOopRef.inline.hpp"
 #include "logging/log.hpp"
@@ -35,12 +36,15 @@
 #include "memory/resourceArea.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "utilities/align.hpp"
+#include "utilities/growableArray.hpp"
 
-BFSClosure::BFSClosure(EdgeQueue* edge_queue, EdgeStore* edge_store, BitSet* mark_bits) :
+BFSClosure::BFSClosure(EdgeQueue* edge_queue, EdgeStore* edge_store, JFRBitSet* mark_bits, WorkGang* workers) :
   _edge_queue(edge_queue),
   _edge_store(edge_store),
   _mark_bits(mark_bits),
+  _workers(workers),
   _current_parent(NULL),
   _current_frontier_level(0),
   _next_frontier_idx(0),
@@ -154,7 +158,6 @@ void BFSClosure::add_chain(UnifiedOopRef reference, const oop pointee) {
 }
 
 void BFSClosure::dfs_fallback() {
-  assert(_edge_queue->is_full(), "invariant");
   _use_dfs = true;
   _dfs_fallback_idx = _edge_queue->bottom();
   while (!_edge_queue->is_empty()) {
@@ -170,12 +173,206 @@ void BFSClosure::process_queue() {
   assert(_next_frontier_idx == 0, "invariant");
   assert(_prev_frontier_idx == 0, "invariant");
 
+  if (_workers != NULL && _workers->total_workers() > 1) {
+    process_queue_parallel();
+    return;
+  }
+
   _next_frontier_idx = _edge_queue->top();
   while (!is_complete()) {
     iterate(_edge_queue->remove()); // edge_queue.remove() increments bottom
   }
 }
 
+// An edge discovered by a parallel worker, not yet in the edge queue
+struct PendingEdge {
+  const Edge* _parent;
+  UnifiedOopRef _reference;
+};
+
+typedef GrowableArray<PendingEdge> PendingEdges;
+
+// Iterates the fields of a frontier object on behalf of a parallel
+// worker, collecting the edges to objects it was first to mark.
+//
+// All workers together collect at most limit edges, the space left in
+// the edge queue. A slot is claimed before marking, so an object is never
+// marked without its edge being collected. Once the limit is reached the
+// worker stops and the frontier is completed with DFS, as when the serial
+// path fills the edge queue.
+class BFSParClosure : public BasicOopIterateClosure {
+ private:
+  JFRBitSet::ParMarker _marker;
+  PendingEdges* const _pending;
+  volatile size_t* const _nof_pending;
+  const size_t _limit;
+  const Edge* _current_parent;
+  bool _overflow;
+
+  void closure_impl(UnifiedOopRef reference, const oop pointee) {
+    if (_overflow || _marker.is_marked(pointee)) {
+      return;
+    }
+    if (Atomic::fetch_and_add(_nof_pending, (size_t)1) >= _limit) {
+      _overflow = true;
+      return;
+    }
+    if (_marker.par_mark_obj(pointee)) {
+      PendingEdge edge = { _current_parent, reference };
+      _pending->append(edge);
+    } else {
+      Atomic::dec(_nof_pending);
+    }
+  }
+
+ public:
+  virtual ReferenceIterationMode reference_iteration_mode() { return DO_FIELDS_EXCEPT_REFERENT; }
+
+  BFSParClosure(JFRBitSet* mark_bits, PendingEdges* pending, volatile size_t* nof_pending, size_t limit) :
+    _marker(mark_bits),
+    _pending(pending),
+    _nof_pending(nof_pending),
+    _limit(limit),
+    _current_parent(NULL),
+    _overflow(false) {}
+
+  bool is_overflow() const { return _overflow; }
+
+  void iterate(const Edge* parent) {
+    _current_parent = parent;
+    parent->pointee()->oop_iterate(this);
+  }
+
+  virtual void do_oop(oop* ref) {
+    const oop pointee = HeapAccess<AS_NO_KEEPALIVE>::oop_load(ref);
+    if (pointee != NULL) {
+      closure_impl(UnifiedOopRef::encode_in_heap(ref), pointee);
+    }
+  }
+
+  virtual void do_oop(narrowOop* ref) {
+    const oop pointee = HeapAccess<AS_NO_KEEPALIVE>::oop_load(ref);
+    if (pointee != NULL) {
+      closure_impl(UnifiedOopRef::encode_in_heap(ref), pointee);
+    }
+  }
+};
+
+// Expands one BFS frontier, the edge queue range [begin, end), with the
+// workers claiming chunks of edges. The edge queue itself is only read.
+class BFSFrontierTask : public AbstractGangTask {
+ private:
+  static const size_t chunk_size = 64;
+
+  const EdgeQueue* const _edge_queue;
+  JFRBitSet* const _mark_bits;
+  PendingEdges** const _pending;
+  const size_t _limit;
+  const size_t _end;
+  volatile size_t _claimed;
+  volatile size_t _nof_pending;
+  volatile bool _overflow;
+
+ public:
+  BFSFrontierTask(const EdgeQueue* edge_queue, JFRBitSet* mark_bits, PendingEdges** pending, size_t limit, size_t begin, size_t end) :
+    AbstractGangTask("JFR BFS Frontier"),
+    _edge_queue(edge_queue),
+    _mark_bits(mark_bits),
+    _pending(pending),
+    _limit(limit),
+    _end(end),
+    _claimed(begin),
+    _nof_pending(0),
+    _overflow(false) {}
+
+  bool is_overflow() const { return Atomic::load(&_overflow); }
+
+  virtual void work(uint worker_id) {
+    BFSParClosure closure(_mark_bits, _pending[worker_id], &_nof_pending, _limit);
+    while (!GranularTimer::is_past_deadline() && !is_overflow()) {
+      const size_t begin = Atomic::fetch_and_add(&_claimed, chunk_size);
+      if (begin >= _end) {
+        return;
+      }
+      const size_t end = MIN2(begin + chunk_size, _end);
+      for (size_t idx = begin; idx < end && !closure.is_overflow(); ++idx) {
+        closure.iterate(_edge_queue->element_at(idx));
+      }
+      if (closure.is_overflow()) {
+        Atomic::store(&_overflow, true);
+      }
+    }
+  }
+};
+
+// Level-synchronous variant of process_queue(). The workers expand each
+// frontier in parallel, marking with atomic updates. The edges they
+// discover are then published serially, so the edge queue, the edge store
+// and the DFS fallback remain single-threaded.
+void BFSClosure::process_queue_parallel() {
+  WithUpdatedActiveWorkers update_and_restore(_workers, _workers->total_workers());
+  const uint nworkers = _workers->active_workers();
+  PendingEdges** const pending = NEW_C_HEAP_ARRAY(PendingEdges*, nworkers, mtTracing);
+  for (uint i = 0; i < nworkers; ++i) {
+    pending[i] = new (ResourceObj::C_HEAP, mtTracing) PendingEdges(1024, mtTracing);
+  }
+
+  const size_t capacity = _edge_queue->reserved_size() / _edge_queue->sizeof_edge();
+  while (!_edge_queue->is_empty() && !GranularTimer::is_past_deadline()) {
+    _prev_frontier_idx = _edge_queue->bottom();
+    _next_frontier_idx = _edge_queue->top();
+    assert(capacity >= _next_frontier_idx, "invariant");
+    BFSFrontierTask task(_edge_queue, _mark_bits, pending, capacity - _next_frontier_idx,
+                         _prev_frontier_idx, _next_frontier_idx);
+    _workers->run_task(&task);
+    if (task.is_overflow()) {
+      // Part of the frontier was left unexpanded. Keep all of it in the
+      // queue so the DFS fallback searches from it again, skipping the
+      // children that were already marked and collected.
+      _use_dfs = true;
+    } else {
+      while (_edge_queue->bottom() < _next_frontier_idx) {
+        _edge_queue->remove();
+      }
+    }
+
+    for (uint i = 0; i < nworkers; ++i) {
+      for (int j = 0; j < pending[i]->length(); ++j) {
+        const PendingEdge& pending_edge = pending[i]->at(j);
+        const Edge edge(pending_edge._parent, pending_edge._reference);
+        // is the pointee a sample object?
+        if (edge.pointee()->mark().is_marked()) {
+          _edge_store->put_chain(&edge, edge.distance_to_root() + 1);
+        }
+        if (_edge_queue->is_full()) {
+          // the pointee is already marked, so search from it directly
+          DFSClosure::find_leaks_from_edge(_edge_store, _mark_bits, &edge);
+        } else {
+          _edge_queue->add(pending_edge._parent, pending_edge._reference);
+          if (_edge_queue->is_full()) {
+            _use_dfs = true;
+          }
+        }
+      }
+      pending[i]->clear();
+    }
+
+    if (_use_dfs) {
+      _use_dfs = false;
+      dfs_fallback();
+      log_dfs_fallback();
+      break;
+    }
+    log_completed_frontier();
+    ++_current_frontier_level;
+  }
+
+  for (uint i = 0; i < nworkers; ++i) {
+    delete pending[i];
+  }
+  FREE_C_HEAP_ARRAY(PendingEdges*, pending);
+}
+
 void BFSClosure::step_frontier() const {
   log_completed_frontier();
   ++_current_frontier_level;
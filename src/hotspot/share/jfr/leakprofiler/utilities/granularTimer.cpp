@@ -73,3 +73,9 @@ bool GranularTimer::is_finished() {
   }
   return false;
 }
+
+// Unbatched and free of side effects, for use by parallel workers
+bool GranularTimer::is_past_deadline() {
+  assert(_granularity != 0, "GranularTimer::is_past_deadline must be called after GranularTimer::start");
+  return _finished || JfrTicks::now() > _finish_time_ticks;
+}
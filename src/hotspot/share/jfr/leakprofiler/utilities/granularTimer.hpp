@@ -41,6 +41,7 @@ class GranularTimer : public AllStatic {
   static const JfrTicks& start_time();
   static const JfrTicks& end_time();
   static bool is_finished();
+  static bool is_past_deadline();
 };
 
 #endif // SHARE_JFR_LEAKPROFILER_UTILITIES_GRANULARTIMER_HPP
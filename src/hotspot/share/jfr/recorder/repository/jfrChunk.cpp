@@ -98,6 +98,9 @@ void JfrChunk::mark_final() {
 
 u2 JfrChunk::flags() const {
   // chunk capabilities, CompressedIntegers etc
+  // There is no capability for block compressed payloads, since every
+  // chunk reader (the jdk.jfr parser and the jfr tool) would have to
+  // support it before the VM could write such chunks.
   u2 flags = 0;
   if (JfrOptionSet::compressed_integers()) {
     flags |= 1 << 0;
@@ -27,7 +27,9 @@
 #include "jfr/recorder/checkpoint/types/traceid/jfrTraceId.inline.hpp"
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTrace.hpp"
+#include "jfr/recorder/stacktrace/jfrStackWalkCache.hpp"
 #include "jfr/support/jfrMethodLookup.hpp"
+#include "jfr/support/jfrThreadLocal.hpp"
 #include "memory/allocation.inline.hpp"
 #include "oops/instanceKlass.inline.hpp"
 #include "runtime/vframe.inline.hpp"
@@ -238,9 +240,56 @@ void JfrStackTrace::resolve_linenos() const {
   _lineno = true;
 }
 
+// A vframeStream that exposes the physical frame it is positioned at.
+class vframeStreamRecord : public vframeStreamCommon {
+ public:
+  vframeStreamRecord(JavaThread* jt) : vframeStreamCommon(jt, false /* process_frames */) {
+    _stop_at_java_call_stub = false;
+    if (!jt->has_last_Java_frame()) {
+      _mode = at_end_mode;
+      return;
+    }
+    _frame = jt->last_frame();
+    while (!fill_from_frame()) {
+      _prev_frame = _frame;
+      _frame = _frame.sender(&_reg_map);
+    }
+  }
+  // The current vframe is the first one of its physical frame.
+  bool at_frame_start() const { return _mode == interpreted_mode || _vframe_id == 0; }
+  const frame& current_frame() const { return _frame; }
+  const RegisterMap* reg_map() const { return &_reg_map; }
+};
+
+// Completes the trace with the frames cached for the activation at pos and its senders.
+u4 JfrStackTrace::record_from_cache(JfrStackWalkCache* cache, u4 pos, u4 count) {
+  cache->add_senders(pos, count);
+  const u4 last = cache->nr_of_frames();
+  for (u4 i = cache->first_frame(pos); i < last; ++i) {
+    if (count >= _max_frames) {
+      _reached_root = false;
+      break;
+    }
+    const Method* const method = cache->method_at(i);
+    const JfrStackFrame& frame = cache->frame_at(i);
+    // tag the method for the current epoch, as a regular walk would have
+    const traceid mid = JfrTraceId::load(method);
+    assert(mid == frame._methodid, "invariant");
+    _hash = (_hash * 31) + mid;
+    _hash = (_hash * 31) + frame._bci;
+    _hash = (_hash * 31) + frame._type;
+    cache->add(method, count);
+    _frames[count] = frame;
+    count++;
+  }
+  return count;
+}
+
 bool JfrStackTrace::record_safe(JavaThread* thread, int skip) {
   assert(thread == Thread::current(), "Thread stack needs to be walkable");
-  vframeStream vfs(thread, false /* stop_at_java_call_stub */, false /* process_frames */);
+  JfrStackWalkCache* const cache = thread->jfr_thread_local()->stack_walk_cache();
+  cache->begin();
+  vframeStreamRecord vfs(thread);
   u4 count = 0;
   _reached_root = true;
   for (int i = 0; i < skip; i++) {
@@ -251,11 +300,26 @@ bool JfrStackTrace::record_safe(JavaThread* thread, int skip) {
   }
 
   _hash = 1;
+  bool use_cache = true;
   while (!vfs.at_end()) {
     if (count >= _max_frames) {
       _reached_root = false;
       break;
     }
+    if (vfs.at_frame_start()) {
+      const JfrStackWalkCache::Key key(vfs.current_frame());
+      u4 pos;
+      if (use_cache && cache->find(key, &pos)) {
+        if (cache->has_same_senders(vfs.current_frame(), vfs.reg_map(), pos)) {
+          // The rest of the stack is unchanged since the last walk.
+          count = record_from_cache(cache, pos, count);
+          break;
+        }
+        // Do not pay for another failed validation during this walk.
+        use_cache = false;
+      }
+      cache->add(key, count);
+    }
     const Method* method = vfs.method();
     const traceid mid = JfrTraceId::load(method);
     int type = vfs.is_interpreted_frame() ? JfrStackFrame::FRAME_INTERPRETER : JfrStackFrame::FRAME_JIT;
@@ -277,11 +341,15 @@ bool JfrStackTrace::record_safe(JavaThread* thread, int skip) {
     _hash = (_hash * 31) + mid;
     _hash = (_hash * 31) + bci;
     _hash = (_hash * 31) + type;
+    cache->add(method, count);
     _frames[count] = JfrStackFrame(mid, bci, type, method->method_holder());
     count++;
   }
 
   _nr_of_frames = count;
+  if (_reached_root) {
+    cache->commit(_frames, count);
+  }
   return true;
 }
 
@@ -33,8 +33,10 @@ class InstanceKlass;
 class JavaThread;
 class JfrCheckpointWriter;
 class JfrChunkWriter;
+class JfrStackWalkCache;
 
 class JfrStackFrame {
+  friend class JfrStackTrace;
   friend class ObjectSampleCheckpoint;
  private:
   const InstanceKlass* _klass;
@@ -95,6 +97,7 @@ class JfrStackTrace : public JfrCHeapObj {
 
   bool record_thread(JavaThread& thread, frame& frame);
   bool record_safe(JavaThread* thread, int skip);
+  u4 record_from_cache(JfrStackWalkCache* cache, u4 pos, u4 count);
 
   bool have_lineno() const { return _lineno; }
   bool full_stacktrace() const { return _reached_root; }
@@ -28,13 +28,21 @@
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "utilities/globalCounter.inline.hpp"
 
 /*
  * There are two separate repository instances.
  * One instance is dedicated to stacktraces taken as part of the leak profiler subsystem.
  * It is kept separate because at the point of insertion, it is unclear if a trace will be serialized,
  * which is a decision postponed and taken during rotation.
+ *
+ * Lookups are lock-free and run inside a GlobalCounter critical section. Only an insertion
+ * takes the JfrStacktrace_lock, which also serializes the writers that clear a table.
+ * A clearing writer detaches the bucket chains, waits for concurrent readers to leave
+ * their critical sections and only then deletes the detached traces.
  */
 
 static JfrStackTraceRepository* _instance = NULL;
@@ -52,7 +60,7 @@ static JfrStackTraceRepository& leak_profiler_instance() {
 }
 
 JfrStackTraceRepository::JfrStackTraceRepository() : _last_entries(0), _entries(0) {
-  memset(_table, 0, sizeof(_table));
+  memset((void*)_table, 0, sizeof(_table));
 }
 
 JfrStackTraceRepository* JfrStackTraceRepository::create() {
@@ -97,52 +105,77 @@ bool JfrStackTraceRepository::is_modified() const {
   return _last_entries != _entries;
 }
 
+// Called with the JfrStacktrace_lock held. Publishes an empty table and returns the old bucket chains.
+static JfrStackTrace** detach(JfrStackTrace* volatile* table, size_t size) {
+  assert(JfrStacktrace_lock->owned_by_self(), "invariant");
+  JfrStackTrace** const detached = NEW_C_HEAP_ARRAY(JfrStackTrace*, size, mtTracing);
+  for (size_t i = 0; i < size; ++i) {
+    detached[i] = table[i];
+    Atomic::release_store(&table[i], (JfrStackTrace*)NULL);
+  }
+  return detached;
+}
+
+static void delete_detached(JfrStackTrace** detached, size_t size) {
+  assert(!JfrStacktrace_lock->owned_by_self(), "invariant");
+  // Lock-free readers might still be traversing the detached chains.
+  GlobalCounter::write_synchronize();
+  for (size_t i = 0; i < size; ++i) {
+    JfrStackTrace* stacktrace = detached[i];
+    while (stacktrace != NULL) {
+      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
+      delete stacktrace;
+      stacktrace = next;
+    }
+  }
+  FREE_C_HEAP_ARRAY(JfrStackTrace*, detached);
+}
+
 size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
   if (_entries == 0) {
     return 0;
   }
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  assert(_entries > 0, "invariant");
+  JfrStackTrace** detached = NULL;
   int count = 0;
-  for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = _table[i];
-    while (stacktrace != NULL) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
-      if (stacktrace->should_write()) {
-        stacktrace->write(sw);
-        ++count;
+  {
+    MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+    assert(_entries > 0, "invariant");
+    for (u4 i = 0; i < TABLE_SIZE; ++i) {
+      const JfrStackTrace* stacktrace = _table[i];
+      while (stacktrace != NULL) {
+        if (stacktrace->should_write()) {
+          stacktrace->write(sw);
+          ++count;
+        }
+        stacktrace = stacktrace->next();
       }
-      if (clear) {
-        delete stacktrace;
-      }
-      stacktrace = next;
     }
+    if (clear) {
+      detached = detach(_table, TABLE_SIZE);
+      _entries = 0;
+    }
+    _last_entries = _entries;
   }
-  if (clear) {
-    memset(_table, 0, sizeof(_table));
-    _entries = 0;
+  if (detached != NULL) {
+    delete_detached(detached, TABLE_SIZE);
   }
-  _last_entries = _entries;
   return count;
 }
 
 size_t JfrStackTraceRepository::clear(JfrStackTraceRepository& repo) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  if (repo._entries == 0) {
-    return 0;
-  }
-  for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = repo._table[i];
-    while (stacktrace != NULL) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
-      delete stacktrace;
-      stacktrace = next;
+  JfrStackTrace** detached = NULL;
+  size_t processed = 0;
+  {
+    MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+    if (repo._entries == 0) {
+      return 0;
     }
+    detached = detach(repo._table, TABLE_SIZE);
+    processed = repo._entries;
+    repo._entries = 0;
+    repo._last_entries = 0;
   }
-  memset(repo._table, 0, sizeof(repo._table));
-  const size_t processed = repo._entries;
-  repo._entries = 0;
-  repo._last_entries = 0;
+  delete_detached(detached, TABLE_SIZE);
   return processed;
 }
 
@@ -197,24 +230,38 @@ void JfrStackTraceRepository::record_for_leak_profiler(JavaThread* thread, int s
   }
 }
 
-traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  const size_t index = stacktrace._hash % TABLE_SIZE;
-  const JfrStackTrace* table_entry = _table[index];
-
+static const JfrStackTrace* find(const JfrStackTrace* table_entry, const JfrStackTrace& stacktrace) {
   while (table_entry != NULL) {
     if (table_entry->equals(stacktrace)) {
-      return table_entry->id();
+      return table_entry;
     }
     table_entry = table_entry->next();
   }
+  return NULL;
+}
+
+traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
+  const size_t index = stacktrace._hash % TABLE_SIZE;
+  {
+    GlobalCounter::CriticalSection cs(Thread::current());
+    const JfrStackTrace* const entry = find(Atomic::load_acquire(&_table[index]), stacktrace);
+    if (entry != NULL) {
+      return entry->id();
+    }
+  }
 
   if (!stacktrace.have_lineno()) {
     return 0;
   }
 
-  traceid id = ++_next_id;
-  _table[index] = new JfrStackTrace(id, stacktrace, _table[index]);
+  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+  // Re-check, the trace could have been added since the lock-free lookup.
+  const JfrStackTrace* const entry = find(_table[index], stacktrace);
+  if (entry != NULL) {
+    return entry->id();
+  }
+  const traceid id = ++_next_id;
+  Atomic::release_store(&_table[index], new JfrStackTrace(id, stacktrace, _table[index]));
   ++_entries;
   return id;
 }
@@ -222,7 +269,7 @@ traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
 // invariant is that the entry to be resolved actually exists in the table
 const JfrStackTrace* JfrStackTraceRepository::lookup_for_leak_profiler(unsigned int hash, traceid id) {
   const size_t index = (hash % TABLE_SIZE);
-  const JfrStackTrace* trace = leak_profiler_instance()._table[index];
+  const JfrStackTrace* trace = Atomic::load_acquire(&leak_profiler_instance()._table[index]);
   while (trace != NULL && trace->id() != id) {
     trace = trace->next();
   }
@@ -45,7 +45,7 @@ class JfrStackTraceRepository : public JfrCHeapObj {
 
  private:
   static const u4 TABLE_SIZE = 2053;
-  JfrStackTrace* _table[TABLE_SIZE];
+  JfrStackTrace* volatile _table[TABLE_SIZE];
   u4 _last_entries;
   u4 _entries;
 
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "code/compiledMethod.hpp"
+#include "jfr/recorder/stacktrace/jfrStackTrace.hpp"
+#include "jfr/recorder/stacktrace/jfrStackWalkCache.hpp"
+#include "memory/allocation.inline.hpp"
+#include "runtime/frame.inline.hpp"
+#include "runtime/registerMap.hpp"
+
+JfrStackWalkCache::Key::Key(const frame& fr) : _id(fr.id()), _pc(fr.pc()) {
+  assert(is_java_frame(fr), "invariant");
+  if (fr.is_interpreted_frame()) {
+    _code = fr.interpreter_frame_method();
+    _position = (intptr_t)fr.interpreter_frame_bcp();
+  } else {
+    const CompiledMethod* const cm = fr.cb()->as_compiled_method();
+    _code = cm;
+    _position = cm->compile_id();
+  }
+}
+
+JfrStackWalkCache::JfrStackWalkCache(u4 capacity) :
+  _frames(NEW_C_HEAP_ARRAY(JfrStackFrame, capacity, mtTracing)),
+  _capacity(capacity),
+  _nr_of_entries(0),
+  _nr_of_frames(0),
+  _nr_of_new_entries(0),
+  _current(0),
+  _overflow(false) {
+  for (int i = 0; i < 2; ++i) {
+    _entries[i] = NEW_C_HEAP_ARRAY(Entry, capacity, mtTracing);
+    _methods[i] = NEW_C_HEAP_ARRAY(const Method*, capacity, mtTracing);
+  }
+}
+
+JfrStackWalkCache::~JfrStackWalkCache() {
+  for (int i = 0; i < 2; ++i) {
+    FREE_C_HEAP_ARRAY(Entry, _entries[i]);
+    FREE_C_HEAP_ARRAY(const Method*, _methods[i]);
+  }
+  FREE_C_HEAP_ARRAY(JfrStackFrame, _frames);
+}
+
+// Must agree with vframeStreamCommon::fill_from_frame() on which frames are Java frames.
+bool JfrStackWalkCache::is_java_frame(const frame& fr) {
+  return fr.is_interpreted_frame() || (fr.cb() != NULL && fr.cb()->is_compiled());
+}
+
+void JfrStackWalkCache::begin() {
+  _nr_of_new_entries = 0;
+  _overflow = false;
+}
+
+void JfrStackWalkCache::add(const Key& key, u4 index) {
+  if (_nr_of_new_entries == _capacity) {
+    _overflow = true;
+    return;
+  }
+  Entry* const entry = new_entries() + _nr_of_new_entries++;
+  entry->_key = key;
+  entry->_index = index;
+}
+
+void JfrStackWalkCache::add(const Method* method, u4 index) {
+  if (index >= _capacity) {
+    _overflow = true;
+    return;
+  }
+  new_methods()[index] = method;
+}
+
+void JfrStackWalkCache::commit(const JfrStackFrame* frames, u4 nr_of_frames) {
+  if (_overflow || nr_of_frames > _capacity) {
+    return;
+  }
+  memcpy(_frames, frames, nr_of_frames * sizeof(JfrStackFrame));
+  _nr_of_frames = nr_of_frames;
+  _nr_of_entries = _nr_of_new_entries;
+  _current ^= 1;
+}
+
+bool JfrStackWalkCache::find(const Key& key, u4* pos) const {
+  assert(pos != NULL, "invariant");
+  // Entries are ordered from the top of the stack towards the bottom, i.e. by increasing frame id.
+  const Entry* const e = entries();
+  u4 low = 0;
+  u4 high = _nr_of_entries;
+  while (low < high) {
+    const u4 mid = low + (high - low) / 2;
+    if (e[mid]._key._id < key._id) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  if (low == _nr_of_entries || !e[low]._key.equals(key)) {
+    return false;
+  }
+  *pos = low;
+  return true;
+}
+
+bool JfrStackWalkCache::has_same_senders(const frame& fr, const RegisterMap* map, u4 pos) const {
+  assert(pos < _nr_of_entries, "invariant");
+  assert(entries()[pos]._key.equals(Key(fr)), "invariant");
+  const Entry* const e = entries();
+  RegisterMap reg_map(map);
+  frame sender = fr;
+  u4 i = pos + 1;
+  while (true) {
+    sender = sender.sender(&reg_map);
+    if (is_java_frame(sender)) {
+      if (i == _nr_of_entries || !e[i]._key.equals(Key(sender))) {
+        return false;
+      }
+      ++i;
+    } else if (sender.is_first_frame()) {
+      break;
+    }
+  }
+  return i == _nr_of_entries;
+}
+
+void JfrStackWalkCache::add_senders(u4 pos, u4 index) {
+  assert(pos < _nr_of_entries, "invariant");
+  const Entry* const e = entries();
+  const u4 first = e[pos]._index;
+  for (u4 i = pos; i < _nr_of_entries; ++i) {
+    add(e[i]._key, index + (e[i]._index - first));
+  }
+}
+
+const JfrStackFrame& JfrStackWalkCache::frame_at(u4 index) const {
+  assert(index < _nr_of_frames, "invariant");
+  return _frames[index];
+}
+
+const Method* JfrStackWalkCache::method_at(u4 index) const {
+  assert(index < _nr_of_frames, "invariant");
+  return _methods[_current][index];
+}
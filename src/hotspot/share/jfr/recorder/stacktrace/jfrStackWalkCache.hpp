@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#ifndef SHARE_JFR_RECORDER_STACKTRACE_JFRSTACKWALKCACHE_HPP
+#define SHARE_JFR_RECORDER_STACKTRACE_JFRSTACKWALKCACHE_HPP
+
+#include "jfr/utilities/jfrAllocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class frame;
+class JfrStackFrame;
+class Method;
+class RegisterMap;
+
+//
+// Thread local cache of the last complete stack walk taken by JfrStackTrace::record_safe().
+//
+// For every physical Java frame the cache keeps a key identifying the activation,
+// together with the position of the JfrStackFrames decoded for it. When a subsequent
+// walk reaches an activation with an identical key, and the keys of all its senders
+// still match, the bottom part of the stack is unchanged and the cached frames
+// are reused instead of decoding the remaining frames again.
+//
+class JfrStackWalkCache : public JfrCHeapObj {
+ public:
+  class Key {
+    friend class JfrStackWalkCache;
+   private:
+    intptr_t* _id;
+    address _pc;
+    const void* _code;  // Method* for interpreted frames, CompiledMethod* otherwise
+    intptr_t _position; // bcp for interpreted frames, compile id otherwise
+   public:
+    Key(const frame& fr);
+    bool equals(const Key& rhs) const {
+      return _id == rhs._id && _pc == rhs._pc && _code == rhs._code && _position == rhs._position;
+    }
+  };
+
+ private:
+  struct Entry {
+    Key _key;
+    u4 _index;
+  };
+
+  Entry* _entries[2];
+  const Method** _methods[2];
+  JfrStackFrame* _frames;
+  const u4 _capacity;
+  u4 _nr_of_entries;
+  u4 _nr_of_frames;
+  u4 _nr_of_new_entries;
+  int _current;
+  bool _overflow;
+
+  const Entry* entries() const { return _entries[_current]; }
+  Entry* new_entries() const { return _entries[_current ^ 1]; }
+  const Method** new_methods() const { return _methods[_current ^ 1]; }
+
+ public:
+  JfrStackWalkCache(u4 capacity);
+  ~JfrStackWalkCache();
+
+  static bool is_java_frame(const frame& fr);
+
+  // Prepares for recording a new walk, the committed walk stays available for lookups.
+  void begin();
+  void add(const Key& key, u4 index);
+  void add(const Method* method, u4 index);
+  void commit(const JfrStackFrame* frames, u4 nr_of_frames);
+
+  // Position of the committed entry matching key.
+  bool find(const Key& key, u4* pos) const;
+  // Do the senders of fr, the activation found at pos, still match the committed entries.
+  bool has_same_senders(const frame& fr, const RegisterMap* map, u4 pos) const;
+  // Adds the committed entries from pos onwards to the walk being recorded, starting at index.
+  void add_senders(u4 pos, u4 index);
+
+  u4 first_frame(u4 pos) const {
+    assert(pos < _nr_of_entries, "invariant");
+    return entries()[pos]._index;
+  }
+  u4 nr_of_frames() const { return _nr_of_frames; }
+  const JfrStackFrame& frame_at(u4 index) const;
+  const Method* method_at(u4 index) const;
+};
+
+#endif // SHARE_JFR_RECORDER_STACKTRACE_JFRSTACKWALKCACHE_HPP
@@ -327,6 +327,9 @@ static void log_discard(size_t pre_full_count, size_t post_full_count, size_t am
   }
 }
 
+// Without a disk repository, full global buffers are never written out.
+// Discarding the oldest ones keeps a bounded ring of the most recent data,
+// sized by the memorysize option, until a dump writes it to a chunk.
 void JfrStorage::discard_oldest(Thread* thread) {
   if (JfrBuffer_lock->try_lock()) {
     if (!control().should_discard()) {
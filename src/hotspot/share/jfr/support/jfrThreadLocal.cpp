@@ -31,6 +31,7 @@
 #include "jfr/recorder/checkpoint/types/traceid/jfrTraceIdEpoch.hpp"
 #include "jfr/recorder/jfrRecorder.hpp"
 #include "jfr/recorder/service/jfrOptionSet.hpp"
+#include "jfr/recorder/stacktrace/jfrStackWalkCache.hpp"
 #include "jfr/recorder/storage/jfrStorage.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
 #include "memory/allocation.inline.hpp"
@@ -46,6 +47,7 @@ JfrThreadLocal::JfrThreadLocal() :
   _load_barrier_buffer_epoch_0(NULL),
   _load_barrier_buffer_epoch_1(NULL),
   _stackframes(NULL),
+  _stack_walk_cache(NULL),
   _trace_id(JfrTraceId::assign_thread_id()),
   _thread(),
   _data_lost(0),
@@ -134,6 +136,10 @@ void JfrThreadLocal::release(Thread* t) {
     FREE_C_HEAP_ARRAY(JfrStackFrame, _stackframes);
     _stackframes = NULL;
   }
+  if (_stack_walk_cache != NULL) {
+    delete _stack_walk_cache;
+    _stack_walk_cache = NULL;
+  }
   if (_load_barrier_buffer_epoch_0 != NULL) {
     _load_barrier_buffer_epoch_0->set_retired();
     _load_barrier_buffer_epoch_0 = NULL;
@@ -195,6 +201,12 @@ JfrStackFrame* JfrThreadLocal::install_stackframes() const {
   return _stackframes;
 }
 
+JfrStackWalkCache* JfrThreadLocal::install_stack_walk_cache() const {
+  assert(_stack_walk_cache == NULL, "invariant");
+  _stack_walk_cache = new JfrStackWalkCache(stackdepth());
+  return _stack_walk_cache;
+}
+
 ByteSize JfrThreadLocal::trace_id_offset() {
   return in_ByteSize(offset_of(JfrThreadLocal, _trace_id));
 }
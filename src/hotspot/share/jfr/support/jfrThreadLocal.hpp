@@ -31,6 +31,7 @@
 class JavaThread;
 class JfrBuffer;
 class JfrStackFrame;
+class JfrStackWalkCache;
 class Thread;
 
 class JfrThreadLocal {
@@ -42,6 +43,7 @@ class JfrThreadLocal {
   JfrBuffer* _load_barrier_buffer_epoch_0;
   JfrBuffer* _load_barrier_buffer_epoch_1;
   mutable JfrStackFrame* _stackframes;
+  mutable JfrStackWalkCache* _stack_walk_cache;
   mutable traceid _trace_id;
   JfrBlobHandle _thread;
   u8 _data_lost;
@@ -59,6 +61,7 @@ class JfrThreadLocal {
   JfrBuffer* install_native_buffer() const;
   JfrBuffer* install_java_buffer() const;
   JfrStackFrame* install_stackframes() const;
+  JfrStackWalkCache* install_stack_walk_cache() const;
   void release(Thread* t);
   static void release(JfrThreadLocal* tl, Thread* t);
 
@@ -119,6 +122,10 @@ class JfrThreadLocal {
 
   u4 stackdepth() const;
 
+  JfrStackWalkCache* stack_walk_cache() const {
+    return _stack_walk_cache != NULL ? _stack_walk_cache : install_stack_walk_cache();
+  }
+
   void set_stackdepth(u4 depth) {
     _stackdepth = depth;
   }
@@ -462,7 +462,7 @@ void CodeInstaller::initialize_dependencies(JVMCIObject compiled_code, OopRecord
       }
     }
   }
-  if (JvmtiExport::can_hotswap_or_post_breakpoint()) {
+  if (JvmtiExport::can_hotswap_or_post_breakpoint() || AlwaysRecordEvolDependencies) {
     JVMCIObjectArray methods = jvmci_env()->get_HotSpotCompiledCode_methods(compiled_code);
     if (methods.is_non_null()) {
       int length = JVMCIENV->get_length(methods);
@@ -57,6 +57,8 @@
 #include "runtime/vframe_hp.hpp"
 #include "runtime/vmThread.hpp"
 #include "runtime/vmOperations.hpp"
+#include "utilities/globalCounter.inline.hpp"
+#include "utilities/quickSort.hpp"
 
 
 ///////////////////////////////////////////////////////////////
@@ -196,6 +198,7 @@ JvmtiEnvBase::JvmtiEnvBase(jint version) : _env_event_enable() {
   _version = version;
   _env_local_storage = NULL;
   _tag_map = NULL;
+  _method_event_filter = NULL;
   _native_method_prefix_count = 0;
   _native_method_prefixes = NULL;
   _next = NULL;
@@ -282,6 +285,10 @@ JvmtiEnvBase::~JvmtiEnvBase() {
     delete tag_map_to_deallocate;
   }
 
+  // No thread can be inside a filter lookup at a safepoint.
+  delete _method_event_filter;
+  _method_event_filter = NULL;
+
   _magic = BAD_MAGIC;
 }
 
@@ -476,6 +483,67 @@ JvmtiEnvBase::get_all_native_method_prefixes(int* count_ptr) {
   return all_prefixes;
 }
 
+static int compare_method_ids(jmethodID* a, jmethodID* b) {
+  uintptr_t x = (uintptr_t)*a;
+  uintptr_t y = (uintptr_t)*b;
+  return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+JvmtiMethodEventFilter::JvmtiMethodEventFilter(const jmethodID* methods, int length) :
+  _methods(NEW_C_HEAP_ARRAY(jmethodID, length, mtServiceability)),
+  _length(length) {
+  memcpy(_methods, methods, length * sizeof(jmethodID));
+  QuickSort::sort(_methods, _length, compare_method_ids, false);
+}
+
+JvmtiMethodEventFilter::~JvmtiMethodEventFilter() {
+  FREE_C_HEAP_ARRAY(jmethodID, _methods);
+}
+
+bool JvmtiMethodEventFilter::contains(jmethodID method) const {
+  int low = 0;
+  int high = _length - 1;
+  while (low <= high) {
+    int mid = low + (high - low) / 2;
+    if ((uintptr_t)_methods[mid] < (uintptr_t)method) {
+      low = mid + 1;
+    } else if ((uintptr_t)_methods[mid] > (uintptr_t)method) {
+      high = mid - 1;
+    } else {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Replace the MethodEntry/MethodExit filter of this environment. The old
+// filter is freed once no thread can be looking at it any more.
+void
+JvmtiEnvBase::set_method_event_filter(JvmtiMethodEventFilter* filter) {
+  JvmtiMethodEventFilter* old_filter = Atomic::xchg(&_method_event_filter, filter);
+  if (old_filter != NULL) {
+    GlobalCounter::write_synchronize();
+    delete old_filter;
+  }
+}
+
+// Tells if MethodEntry/MethodExit events for the given method should be
+// posted to this environment. Methods without a jmethodID cannot have been
+// selected by the agent.
+bool
+JvmtiEnvBase::is_method_event_selected(JavaThread* thread, Method* method) {
+  if (Atomic::load(&_method_event_filter) == NULL) {
+    return true;
+  }
+  GlobalCounter::CriticalSection cs(thread);
+  JvmtiMethodEventFilter* filter = Atomic::load_acquire(&_method_event_filter);
+  if (filter == NULL) {
+    return true;
+  }
+  jmethodID id = method->find_jmethod_id_or_null();
+  return id != NULL && filter->contains(id);
+}
+
 void
 JvmtiEnvBase::set_event_callbacks(const jvmtiEventCallbacks* callbacks,
                                                jint size_of_callbacks) {
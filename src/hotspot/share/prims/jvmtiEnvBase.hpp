@@ -48,6 +48,24 @@ class JvmtiEventControllerPrivate;
 class JvmtiTagMap;
 
 
+// The methods for which an environment wants MethodEntry and MethodExit
+// events, as set with the SetMethodEventFilter extension function. It is
+// checked when an event is posted, so it does not change which threads
+// run in interp-only mode.
+// A filter is immutable once published, so readers only need to be in a
+// GlobalCounter critical section while they use it.
+class JvmtiMethodEventFilter : public CHeapObj<mtServiceability> {
+ private:
+  jmethodID* _methods;  // sorted by address
+  int _length;
+
+ public:
+  JvmtiMethodEventFilter(const jmethodID* methods, int length);
+  ~JvmtiMethodEventFilter();
+
+  bool contains(jmethodID method) const;
+};
+
 
 // One JvmtiEnv object is created per jvmti attachment;
 // done via JNI GetEnv() call. Multiple attachments are
@@ -99,6 +117,7 @@ class JvmtiEnvBase : public CHeapObj<mtInternal> {
   jvmtiEventCallbacks _event_callbacks;
   jvmtiExtEventCallbacks _ext_event_callbacks;
   JvmtiTagMap* volatile _tag_map;
+  JvmtiMethodEventFilter* volatile _method_event_filter;
   JvmtiEnvEventEnable _env_event_enable;
   jvmtiCapabilities _current_capabilities;
   jvmtiCapabilities _prohibited_capabilities;
@@ -172,6 +191,10 @@ class JvmtiEnvBase : public CHeapObj<mtInternal> {
 
   static char** get_all_native_method_prefixes(int* count_ptr);
 
+  // MethodEntry/MethodExit filter; a NULL filter selects all methods
+  void set_method_event_filter(JvmtiMethodEventFilter* filter);
+  bool is_method_event_selected(JavaThread* thread, Method* method);
+
   // This test will answer true when all environments have been disposed and some have
   // not yet been deallocated.  As a result, this test should only be used as an
   // optimization for the no environment case.
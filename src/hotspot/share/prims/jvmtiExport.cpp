@@ -1556,7 +1556,8 @@ void JvmtiExport::post_method_entry(JavaThread *thread, Method* method, frame cu
   if (state->is_enabled(JVMTI_EVENT_METHOD_ENTRY)) {
     JvmtiEnvThreadStateIterator it(state);
     for (JvmtiEnvThreadState* ets = it.first(); ets != NULL; ets = it.next(ets)) {
-      if (ets->is_enabled(JVMTI_EVENT_METHOD_ENTRY)) {
+      if (ets->is_enabled(JVMTI_EVENT_METHOD_ENTRY) &&
+          ets->get_env()->is_method_event_selected(thread, mh())) {
         EVT_TRACE(JVMTI_EVENT_METHOD_ENTRY, ("[%s] Evt Method Entry sent %s.%s",
                                              JvmtiTrace::safe_get_thread_name(thread),
                                              (mh() == NULL) ? "NULL" : mh()->klass_name()->as_C_string(),
@@ -1635,7 +1636,8 @@ void JvmtiExport::post_method_exit_inner(JavaThread* thread,
   if (state->is_enabled(JVMTI_EVENT_METHOD_EXIT)) {
     JvmtiEnvThreadStateIterator it(state);
     for (JvmtiEnvThreadState* ets = it.first(); ets != NULL; ets = it.next(ets)) {
-      if (ets->is_enabled(JVMTI_EVENT_METHOD_EXIT)) {
+      if (ets->is_enabled(JVMTI_EVENT_METHOD_EXIT) &&
+          ets->get_env()->is_method_event_selected(thread, mh())) {
         EVT_TRACE(JVMTI_EVENT_METHOD_EXIT, ("[%s] Evt Method Exit sent %s.%s",
                                             JvmtiTrace::safe_get_thread_name(thread),
                                             (mh() == NULL) ? "NULL" : mh()->klass_name()->as_C_string(),
@@ -23,8 +23,18 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/javaClasses.inline.hpp"
+#include "classfile/vmClasses.hpp"
+#include "oops/method.hpp"
+#include "oops/oop.inline.hpp"
 #include "prims/jvmtiExport.hpp"
 #include "prims/jvmtiExtensions.hpp"
+#include "prims/jvmtiTagMap.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/jniHandles.inline.hpp"
+#include "runtime/thread.inline.hpp"
+#include "runtime/timerTrace.hpp"
 
 // the list of extension functions
 GrowableArray<jvmtiExtensionFunctionInfo*>* JvmtiExtensions::_ext_functions;
@@ -49,14 +59,136 @@ static jvmtiError JNICALL IsClassUnloadingEnabled(const jvmtiEnv* env, ...) {
   return JVMTI_ERROR_NONE;
 }
 
+// extension function taking the same arguments as IterateThroughHeap.
+// The heap is iterated on the GC's safepoint workers if the GC supports
+// parallel object iteration, so the callbacks may be invoked concurrently
+// from several threads and must be thread-safe. Objects are visited in no
+// particular order. Tag updates made through the tag pointers are applied
+// as for IterateThroughHeap. Returning JVMTI_VISIT_ABORT stops all workers,
+// but objects already being visited by other workers are still reported.
+static jvmtiError JNICALL IterateThroughHeapParallel(const jvmtiEnv* env, ...) {
+  jint heap_filter;
+  jclass klass;
+  const jvmtiHeapCallbacks* callbacks;
+  const void* user_data;
+  va_list ap;
+
+  va_start(ap, env);
+  heap_filter = va_arg(ap, jint);
+  klass = va_arg(ap, jclass);
+  callbacks = va_arg(ap, const jvmtiHeapCallbacks*);
+  user_data = va_arg(ap, const void*);
+  va_end(ap);
+
+  JvmtiEnv* jvmti_env = JvmtiEnv::JvmtiEnv_from_jvmti_env((jvmtiEnv*)env);
+  if (!jvmti_env->is_valid()) {
+    return JVMTI_ERROR_INVALID_ENVIRONMENT;
+  }
+  if (jvmti_env->phase() != JVMTI_PHASE_LIVE) {
+    return JVMTI_ERROR_WRONG_PHASE;
+  }
+  if (jvmti_env->get_capabilities()->can_tag_objects == 0) {
+    return JVMTI_ERROR_MUST_POSSESS_CAPABILITY;
+  }
+  if (callbacks == NULL) {
+    return JVMTI_ERROR_NULL_POINTER;
+  }
+  Thread* thread = Thread::current_or_null();
+  if (thread == NULL || !thread->is_Java_thread()) {
+    return JVMTI_ERROR_UNATTACHED_THREAD;
+  }
+  JavaThread* current_thread = thread->as_Java_thread();
+  ThreadInVMfromNative tiv(current_thread);
+  HandleMark hm(current_thread);
+
+  // check klass if provided
+  Klass* k = NULL;
+  if (klass != NULL) {
+    oop k_mirror = JNIHandles::resolve_external_guard(klass);
+    if (k_mirror == NULL) {
+      return JVMTI_ERROR_INVALID_CLASS;
+    }
+    if (!k_mirror->is_a(vmClasses::Class_klass())) {
+      return JVMTI_ERROR_INVALID_CLASS;
+    }
+    if (java_lang_Class::is_primitive(k_mirror)) {
+      return JVMTI_ERROR_NONE;
+    }
+    k = java_lang_Class::as_Klass(k_mirror);
+    if (k == NULL) {
+      return JVMTI_ERROR_INVALID_CLASS;
+    }
+  }
+
+  TraceTime t("IterateThroughHeapParallel", TRACETIME_LOG(Debug, jvmti, objecttagging));
+  JvmtiTagMap::tag_map_for(jvmti_env)->iterate_through_heap(heap_filter, k, callbacks, user_data,
+                                                            true /* parallel */);
+  return JVMTI_ERROR_NONE;
+}
+
+// extension function restricting the MethodEntry and MethodExit events of
+// an environment to the given methods. A method_count of zero removes the
+// restriction. This is a posting filter only: threads with these events
+// enabled still run in interp-only mode and still call into the VM on every
+// method entry and exit. For methods outside the filter it saves creating
+// the JNI local handles, the transition to native and the agent callback.
+static jvmtiError JNICALL SetMethodEventFilter(const jvmtiEnv* env, ...) {
+  jint method_count;
+  const jmethodID* methods;
+  va_list ap;
+
+  va_start(ap, env);
+  method_count = va_arg(ap, jint);
+  methods = va_arg(ap, const jmethodID*);
+  va_end(ap);
+
+  JvmtiEnv* jvmti_env = JvmtiEnv::JvmtiEnv_from_jvmti_env((jvmtiEnv*)env);
+  if (!jvmti_env->is_valid()) {
+    return JVMTI_ERROR_INVALID_ENVIRONMENT;
+  }
+  if (jvmti_env->phase() != JVMTI_PHASE_LIVE) {
+    return JVMTI_ERROR_WRONG_PHASE;
+  }
+  if (jvmti_env->get_capabilities()->can_generate_method_entry_events == 0 &&
+      jvmti_env->get_capabilities()->can_generate_method_exit_events == 0) {
+    return JVMTI_ERROR_MUST_POSSESS_CAPABILITY;
+  }
+  if (method_count < 0) {
+    return JVMTI_ERROR_ILLEGAL_ARGUMENT;
+  }
+  if (method_count > 0 && methods == NULL) {
+    return JVMTI_ERROR_NULL_POINTER;
+  }
+  Thread* thread = Thread::current_or_null();
+  if (thread == NULL || !thread->is_Java_thread()) {
+    return JVMTI_ERROR_UNATTACHED_THREAD;
+  }
+  ThreadInVMfromNative tiv(thread->as_Java_thread());
+
+  for (int i = 0; i < method_count; i++) {
+    if (Method::checked_resolve_jmethod_id(methods[i]) == NULL) {
+      return JVMTI_ERROR_INVALID_METHODID;
+    }
+  }
+
+  JvmtiMethodEventFilter* filter = NULL;
+  if (method_count > 0) {
+    filter = new JvmtiMethodEventFilter(methods, method_count);
+  }
+  jvmti_env->set_method_event_filter(filter);
+  return JVMTI_ERROR_NONE;
+}
+
 // register extension functions and events. In this implementation we
-// have a single extension function (to prove the API) that tests if class
-// unloading is enabled or disabled. We also have a single extension event
+// have an extension function (to prove the API) that tests if class
+// unloading is enabled or disabled, an extension function that iterates
+// the heap in parallel and one that filters method entry/exit events. We
+// also have a single extension event
 // EXT_EVENT_CLASS_UNLOAD which is used to provide the JVMDI_EVENT_CLASS_UNLOAD
-// event. The function and the event are registered here.
+// event. The functions and the event are registered here.
 //
 void JvmtiExtensions::register_extensions() {
-  _ext_functions = new (ResourceObj::C_HEAP, mtServiceability) GrowableArray<jvmtiExtensionFunctionInfo*>(1, mtServiceability);
+  _ext_functions = new (ResourceObj::C_HEAP, mtServiceability) GrowableArray<jvmtiExtensionFunctionInfo*>(3, mtServiceability);
   _ext_events = new (ResourceObj::C_HEAP, mtServiceability) GrowableArray<jvmtiExtensionEventInfo*>(1, mtServiceability);
 
   // register our extension function
@@ -74,6 +206,46 @@ void JvmtiExtensions::register_extensions() {
   };
   _ext_functions->append(&ext_func);
 
+  static jvmtiParamInfo iterate_params[] = {
+    { (char*)"heap_filter", JVMTI_KIND_IN,     JVMTI_TYPE_JINT,   JNI_FALSE },
+    { (char*)"klass",       JVMTI_KIND_IN,     JVMTI_TYPE_JCLASS, JNI_TRUE },
+    { (char*)"callbacks",   JVMTI_KIND_IN_PTR, JVMTI_TYPE_CVOID,  JNI_FALSE },
+    { (char*)"user_data",   JVMTI_KIND_IN_PTR, JVMTI_TYPE_CVOID,  JNI_TRUE }
+  };
+  static jvmtiError iterate_errors[] = {
+    JVMTI_ERROR_MUST_POSSESS_CAPABILITY,
+    JVMTI_ERROR_INVALID_CLASS
+  };
+  static jvmtiExtensionFunctionInfo iterate_func = {
+    (jvmtiExtensionFunction)IterateThroughHeapParallel,
+    (char*)"com.sun.hotspot.functions.IterateThroughHeapParallel",
+    (char*)"IterateThroughHeap on the GC worker threads; callbacks must be thread-safe",
+    sizeof(iterate_params)/sizeof(iterate_params[0]),
+    iterate_params,
+    sizeof(iterate_errors)/sizeof(iterate_errors[0]),
+    iterate_errors
+  };
+  _ext_functions->append(&iterate_func);
+
+  static jvmtiParamInfo filter_params[] = {
+    { (char*)"method_count", JVMTI_KIND_IN,     JVMTI_TYPE_JINT,      JNI_FALSE },
+    { (char*)"methods",      JVMTI_KIND_IN_BUF, JVMTI_TYPE_JMETHODID, JNI_TRUE }
+  };
+  static jvmtiError filter_errors[] = {
+    JVMTI_ERROR_MUST_POSSESS_CAPABILITY,
+    JVMTI_ERROR_INVALID_METHODID
+  };
+  static jvmtiExtensionFunctionInfo filter_func = {
+    (jvmtiExtensionFunction)SetMethodEventFilter,
+    (char*)"com.sun.hotspot.functions.SetMethodEventFilter",
+    (char*)"Post MethodEntry/MethodExit events only for the given methods; threads still run interpreted",
+    sizeof(filter_params)/sizeof(filter_params[0]),
+    filter_params,
+    sizeof(filter_errors)/sizeof(filter_errors[0]),
+    filter_errors
+  };
+  _ext_functions->append(&filter_func);
+
   // register our extension event
 
   static jvmtiParamInfo event_params[] = {
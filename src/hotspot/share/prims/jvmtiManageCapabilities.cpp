@@ -318,6 +318,7 @@ void JvmtiManageCapabilities::update() {
     // Disable these when tracking the bytecodes
     UseFastEmptyMethods = false;
     UseFastAccessorMethods = false;
+    UseFastMathMethods = false;
   }
 #endif // ZERO
 
@@ -328,10 +329,11 @@ void JvmtiManageCapabilities::update() {
     RewriteFrequentPairs = false;
   }
 
-  // If can_redefine_classes is enabled in the onload phase then we know that the
+  // If can_redefine_classes is enabled in the onload phase, or the compilers
+  // record evol dependencies unconditionally, then we know that the
   // dependency information recorded by the compiler is complete.
   if ((avail.can_redefine_classes || avail.can_retransform_classes) &&
-      JvmtiEnv::get_phase() == JVMTI_PHASE_ONLOAD) {
+      (JvmtiEnv::get_phase() == JVMTI_PHASE_ONLOAD || AlwaysRecordEvolDependencies)) {
     JvmtiExport::set_all_dependencies_are_recorded(true);
   }
 
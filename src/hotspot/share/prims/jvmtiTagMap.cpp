@@ -29,6 +29,7 @@
 #include "classfile/vmClasses.hpp"
 #include "classfile/vmSymbols.hpp"
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "jvmtifiles/jvmtiEnv.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
@@ -49,7 +50,7 @@
 #include "prims/jvmtiImpl.hpp"
 #include "prims/jvmtiTagMap.hpp"
 #include "prims/jvmtiTagMapTable.hpp"
-#include "runtime/biasedLocking.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/deoptimization.hpp"
 #include "runtime/frame.inline.hpp"
 #include "runtime/handles.inline.hpp"
@@ -58,6 +59,7 @@
 #include "runtime/jniHandles.inline.hpp"
 #include "runtime/mutex.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/orderAccess.hpp"
 #include "runtime/reflectionUtils.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/timerTrace.hpp"
@@ -66,7 +68,9 @@
 #include "runtime/vframe.hpp"
 #include "runtime/vmThread.hpp"
 #include "runtime/vmOperations.hpp"
+#include "utilities/growableArray.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/objectBitSet.inline.hpp"
 
 bool JvmtiTagMap::_has_object_free_events = false;
 
@@ -75,7 +79,6 @@ JvmtiTagMap::JvmtiTagMap(JvmtiEnv* env) :
   _env(env),
   _lock(Mutex::nonleaf+1, "JvmtiTagMap_lock", Mutex::_allow_vm_block_flag,
         Mutex::_safepoint_check_never),
-  _needs_rehashing(false),
   _needs_cleaning(false) {
 
   assert(JvmtiThreadState_lock->is_locked(), "sanity check");
@@ -134,9 +137,8 @@ bool JvmtiTagMap::is_empty() {
   return hashmap()->is_empty();
 }
 
-// This checks for posting and rehashing before operations that
-// this tagmap table.  The calls from a JavaThread only rehash, posting is
-// only done before heap walks.
+// This checks for posting before heap walks. The table is keyed by identity
+// hash, so it never needs rehashing after objects have been moved.
 void JvmtiTagMap::check_hashmap(bool post_events) {
   assert(!post_events || SafepointSynchronize::is_at_safepoint(), "precondition");
   assert(is_locked(), "checking");
@@ -148,14 +150,9 @@ void JvmtiTagMap::check_hashmap(bool post_events) {
       env()->is_enabled(JVMTI_EVENT_OBJECT_FREE)) {
     remove_dead_entries_locked(true /* post_object_free */);
   }
-  if (_needs_rehashing) {
-    log_info(jvmti, table)("TagMap table needs rehashing");
-    hashmap()->rehash();
-    _needs_rehashing = false;
-  }
 }
 
-// This checks for posting and rehashing and is called from the heap walks.
+// This checks for posting and is called from the heap walks.
 void JvmtiTagMap::check_hashmaps_for_heapwalk() {
   assert(SafepointSynchronize::is_at_safepoint(), "called from safepoints");
 
@@ -187,6 +184,76 @@ static inline jlong tag_for(JvmtiTagMap* tag_map, oop o) {
 }
 
 
+// Tag updates made by the callbacks of a parallel heap iteration. Adding an
+// object to the tag map installs its identity hash, which may revoke a bias
+// or inflate a monitor, so only the VM thread may do it. Each worker records
+// its new, changed and cleared tags in a list of its own, and the VM thread
+// applies them once the workers are done. The tag map is therefore not
+// modified during the walk, and the workers look up tags without a lock.
+class ParallelIterationTags : AllStatic {
+ private:
+  struct NewTag {
+    oop _o;
+    jlong _tag;
+  };
+  typedef GrowableArray<NewTag> NewTags;
+
+  static NewTags** _new_tags;
+  static uint _num_workers;
+
+ public:
+  static void begin(uint num_workers);
+  // A zero tag untags the object
+  static void record(oop o, jlong tag);
+  static void end(JvmtiTagMap* tag_map);
+};
+
+ParallelIterationTags::NewTags** ParallelIterationTags::_new_tags = NULL;
+uint ParallelIterationTags::_num_workers = 0;
+
+void ParallelIterationTags::begin(uint num_workers) {
+  assert(Thread::current()->is_VM_thread(), "must be VMThread");
+  assert(_new_tags == NULL, "parallel iterations cannot be nested");
+  _num_workers = num_workers;
+  _new_tags = NEW_C_HEAP_ARRAY(NewTags*, num_workers, mtServiceability);
+  for (uint i = 0; i < num_workers; i++) {
+    _new_tags[i] = new (ResourceObj::C_HEAP, mtServiceability) NewTags(0, mtServiceability);
+  }
+}
+
+void ParallelIterationTags::record(oop o, jlong tag) {
+  const uint id = Thread::current()->as_Worker_thread()->id();
+  assert(id < _num_workers, "worker id out of range");
+  NewTag new_tag = { o, tag };
+  _new_tags[id]->append(new_tag);
+}
+
+void ParallelIterationTags::end(JvmtiTagMap* tag_map) {
+  assert(Thread::current()->is_VM_thread(), "must be VMThread");
+  JvmtiTagMapTable* hashmap = tag_map->hashmap();
+  for (uint i = 0; i < _num_workers; i++) {
+    NewTags* new_tags = _new_tags[i];
+    for (int j = 0; j < new_tags->length(); j++) {
+      const oop o = new_tags->at(j)._o;
+      const jlong tag = new_tags->at(j)._tag;
+      JvmtiTagMapEntry* entry = hashmap->find(o);
+      if (tag == 0) {
+        if (entry != NULL) {
+          hashmap->remove(o);
+        }
+      } else if (entry == NULL) {
+        hashmap->add(o, tag);
+      } else {
+        entry->set_tag(tag);
+      }
+    }
+    delete new_tags;
+  }
+  FREE_C_HEAP_ARRAY(NewTags*, _new_tags);
+  _new_tags = NULL;
+  _num_workers = 0;
+}
+
 // A CallbackWrapper is a support class for querying and tagging an object
 // around a callback to a profiler. The constructor does pre-callback
 // work to get the tag value, klass tag value, ... and the destructor
@@ -219,8 +286,8 @@ class CallbackWrapper : public StackObj {
                                        JvmtiTagMapEntry* entry, jlong obj_tag);
  public:
   CallbackWrapper(JvmtiTagMap* tag_map, oop o) {
-    assert(Thread::current()->is_VM_thread() || tag_map->is_locked(),
-           "MT unsafe or must be VM thread");
+    assert(Thread::current()->is_VM_thread() || Thread::current()->is_Worker_thread() ||
+           tag_map->is_locked(), "MT unsafe or must be VM thread");
 
     // object to tag
     _o = o;
@@ -259,6 +326,13 @@ void inline CallbackWrapper::post_callback_tag_update(oop o,
                                                       JvmtiTagMapTable* hashmap,
                                                       JvmtiTagMapEntry* entry,
                                                       jlong obj_tag) {
+  if (Thread::current()->is_Worker_thread()) {
+    // parallel heap iteration: the VM thread applies the update afterwards
+    if (obj_tag != ((entry == NULL) ? 0 : entry->tag())) {
+      ParallelIterationTags::record(o, obj_tag);
+    }
+    return;
+  }
   if (entry == NULL) {
     if (obj_tag != 0) {
       // callback has tagged the object
@@ -347,18 +421,25 @@ class TwoOopCallbackWrapper : public CallbackWrapper {
   inline jlong referrer_klass_tag()     { return _referrer_klass_tag; }
 };
 
+// Install the identity hash of an object that may get tagged, or looked up,
+// before taking the tag map lock. Installing it may need to revoke a bias,
+// which can safepoint, or to inflate the monitor of a locked object.
+static void prepare_identity_hash(jobject object, bool add) {
+  oop o = JNIHandles::resolve_non_null(object);
+  if (add || !JvmtiTagMapTable::has_no_hash(o)) {
+    o->identity_hash();
+  }
+}
+
 // tag an object
 //
 // This function is performance critical. If many threads attempt to tag objects
 // around the same time then it's possible that the Mutex associated with the
 // tag map will be a hot lock.
 void JvmtiTagMap::set_tag(jobject object, jlong tag) {
-  MutexLocker ml(lock(), Mutex::_no_safepoint_check_flag);
+  prepare_identity_hash(object, tag != 0);
 
-  // SetTag should not post events because the JavaThread has to
-  // transition to native for the callback and this cannot stop for
-  // safepoints with the hashmap lock held.
-  check_hashmap(/*post_events*/ false);
+  MutexLocker ml(lock(), Mutex::_no_safepoint_check_flag);
 
   // resolve the object
   oop o = JNIHandles::resolve_non_null(object);
@@ -388,12 +469,9 @@ void JvmtiTagMap::set_tag(jobject object, jlong tag) {
 
 // get the tag for an object
 jlong JvmtiTagMap::get_tag(jobject object) {
-  MutexLocker ml(lock(), Mutex::_no_safepoint_check_flag);
+  prepare_identity_hash(object, false);
 
-  // GetTag should not post events because the JavaThread has to
-  // transition to native for the callback and this cannot stop for
-  // safepoints with the hashmap lock held.
-  check_hashmap(/*post_events*/ false);
+  MutexLocker ml(lock(), Mutex::_no_safepoint_check_flag);
 
   // resolve the object
   oop o = JNIHandles::resolve_non_null(object);
@@ -533,6 +611,9 @@ class JvmtiCachedClassFieldMap : public CHeapObj<mtInternal> {
   static GrowableArray<InstanceKlass*>* _class_list;
   static void add_to_class_list(InstanceKlass* ik);
 
+  // serializes cache misses of parallel heap iteration workers
+  static Mutex* _lock;
+
  public:
   // returns the field map for a given object (returning map cached
   // by InstanceKlass if possible
@@ -544,9 +625,13 @@ class JvmtiCachedClassFieldMap : public CHeapObj<mtInternal> {
 
   // returns the number of ClassFieldMap cached by instanceKlasses
   static int cached_field_map_count();
+
+  // creates the lock used by parallel heap iteration workers
+  static void initialize_lock();
 };
 
 GrowableArray<InstanceKlass*>* JvmtiCachedClassFieldMap::_class_list;
+Mutex* JvmtiCachedClassFieldMap::_lock = NULL;
 
 JvmtiCachedClassFieldMap::JvmtiCachedClassFieldMap(ClassFieldMap* field_map) {
   _field_map = field_map;
@@ -568,6 +653,7 @@ class ClassFieldMapCacheMark : public StackObj {
      assert(Thread::current()->is_VM_thread(), "must be VMThread");
      assert(JvmtiCachedClassFieldMap::cached_field_map_count() == 0, "cache not empty");
      assert(!_is_active, "ClassFieldMapCacheMark cannot be nested");
+     JvmtiCachedClassFieldMap::initialize_lock();
      _is_active = true;
    }
    ~ClassFieldMapCacheMark() {
@@ -589,10 +675,23 @@ void JvmtiCachedClassFieldMap::add_to_class_list(InstanceKlass* ik) {
   _class_list->push(ik);
 }
 
+void JvmtiCachedClassFieldMap::initialize_lock() {
+  assert(Thread::current()->is_VM_thread(), "must be VMThread");
+  if (_lock == NULL) {
+    _lock = new Mutex(Mutex::leaf, "JvmtiCachedClassFieldMap_lock",
+                      Mutex::_allow_vm_block_flag, Mutex::_safepoint_check_never);
+  }
+}
+
 // returns the instance field map for the given object
 // (returns field map cached by the InstanceKlass if possible)
+//
+// Workers of a parallel heap iteration share the cache. A cached map is
+// published only once it is fully built, so hits need no lock; misses are
+// resolved under _lock so each class gets a single map.
 ClassFieldMap* JvmtiCachedClassFieldMap::get_map_of_instance_fields(oop obj) {
-  assert(Thread::current()->is_VM_thread(), "must be VMThread");
+  assert(Thread::current()->is_VM_thread() || Thread::current()->is_Worker_thread(),
+         "must be VMThread or heap iteration worker");
   assert(ClassFieldMapCacheMark::is_active(), "ClassFieldMapCacheMark not active");
 
   Klass* k = obj->klass();
@@ -603,13 +702,20 @@ ClassFieldMap* JvmtiCachedClassFieldMap::get_map_of_instance_fields(oop obj) {
   if (cached_map != NULL) {
     assert(cached_map->field_map() != NULL, "missing field list");
     return cached_map->field_map();
-  } else {
-    ClassFieldMap* field_map = ClassFieldMap::create_map_of_instance_fields(obj);
-    cached_map = new JvmtiCachedClassFieldMap(field_map);
-    ik->set_jvmti_cached_class_field_map(cached_map);
-    add_to_class_list(ik);
-    return field_map;
   }
+
+  MutexLocker ml(Thread::current()->is_Worker_thread() ? _lock : NULL,
+                 Mutex::_no_safepoint_check_flag);
+  cached_map = ik->jvmti_cached_class_field_map();
+  if (cached_map != NULL) {
+    return cached_map->field_map();
+  }
+  ClassFieldMap* field_map = ClassFieldMap::create_map_of_instance_fields(obj);
+  cached_map = new JvmtiCachedClassFieldMap(field_map);
+  OrderAccess::storestore();
+  ik->set_jvmti_cached_class_field_map(cached_map);
+  add_to_class_list(ik);
+  return field_map;
 }
 
 // remove the fields maps cached from all instanceKlasses
@@ -885,11 +991,56 @@ static jint invoke_primitive_field_callback_for_instance_fields(
 
 // VM operation to iterate over all objects in the heap (both reachable
 // and unreachable)
+// A task that applies a closure to the heap using the GC's parallel
+// object iterator.
+class ParHeapIterateTask : public AbstractGangTask {
+ private:
+  ParallelObjectIterator* _poi;
+  ObjectClosure* _blk;
+
+ public:
+  ParHeapIterateTask(ParallelObjectIterator* poi, ObjectClosure* blk) :
+    AbstractGangTask("Iterating heap for JVMTI"),
+    _poi(poi),
+    _blk(blk) {}
+
+  void work(uint worker_id) {
+    ResourceMark rm;
+    _poi->object_iterate(_blk, worker_id);
+  }
+};
+
 class VM_HeapIterateOperation: public VM_Operation {
  private:
   ObjectClosure* _blk;
+  JvmtiTagMap* _parallel_tag_map;
+
+  // Iterates the heap on the GC's safepoint workers. Returns false if the
+  // GC does not support parallel iteration. Tags the callbacks set on
+  // untagged objects are added to the tag map after the workers finish.
+  bool parallel_object_iterate() {
+    WorkGang* gang = Universe::heap()->safepoint_workers();
+    if (gang == NULL) {
+      return false;
+    }
+    WithUpdatedActiveWorkers update_and_restore(gang, gang->total_workers());
+    ParallelObjectIterator* poi = Universe::heap()->parallel_object_iterator(gang->active_workers());
+    if (poi == NULL) {
+      return false;
+    }
+    ParallelIterationTags::begin(gang->total_workers());
+    ParHeapIterateTask task(poi, _blk);
+    gang->run_task(&task);
+    delete poi;
+    ParallelIterationTags::end(_parallel_tag_map);
+    return true;
+  }
+
  public:
-  VM_HeapIterateOperation(ObjectClosure* blk) { _blk = blk; }
+  // With a parallel_tag_map the heap may be iterated on the GC's
+  // safepoint workers; the closure must then update tags in that map only.
+  VM_HeapIterateOperation(ObjectClosure* blk, JvmtiTagMap* parallel_tag_map = NULL) :
+    _blk(blk), _parallel_tag_map(parallel_tag_map) {}
 
   VMOp_Type type() const { return VMOp_HeapIterateOperation; }
   void doit() {
@@ -908,6 +1059,9 @@ class VM_HeapIterateOperation: public VM_Operation {
     }
 
     // do the iteration
+    if (_parallel_tag_map != NULL && parallel_object_iterate()) {
+      return;
+    }
     Universe::heap()->object_iterate(_blk);
   }
 
@@ -1009,9 +1163,10 @@ class IterateThroughHeapObjectClosure: public ObjectClosure {
   Klass* klass() const                             { return _klass; }
   const void* user_data() const                    { return _user_data; }
 
-  // indicates if the iteration has been aborted
-  bool _iteration_aborted;
-  bool is_iteration_aborted() const                { return _iteration_aborted; }
+  // indicates if the iteration has been aborted; shared by the workers
+  // of a parallel iteration
+  volatile bool _iteration_aborted;
+  bool is_iteration_aborted() const                { return Atomic::load(&_iteration_aborted); }
 
   // used to check the visit control flags. If the abort flag is set
   // then we set the iteration aborted flag so that the iteration completes
@@ -1019,7 +1174,7 @@ class IterateThroughHeapObjectClosure: public ObjectClosure {
   bool check_flags_for_abort(jint flags) {
     bool is_abort = (flags & JVMTI_VISIT_ABORT) != 0;
     if (is_abort) {
-      _iteration_aborted = true;
+      Atomic::store(&_iteration_aborted, true);
     }
     return is_abort;
   }
@@ -1150,7 +1305,8 @@ void JvmtiTagMap::iterate_over_heap(jvmtiHeapObjectFilter object_filter,
 void JvmtiTagMap::iterate_through_heap(jint heap_filter,
                                        Klass* klass,
                                        const jvmtiHeapCallbacks* callbacks,
-                                       const void* user_data)
+                                       const void* user_data,
+                                       bool parallel)
 {
   // EA based optimizations on tagged objects are already reverted.
   EscapeBarrier eb(!(heap_filter & JVMTI_HEAP_FILTER_UNTAGGED), JavaThread::current());
@@ -1161,7 +1317,7 @@ void JvmtiTagMap::iterate_through_heap(jint heap_filter,
                                       heap_filter,
                                       callbacks,
                                       user_data);
-  VM_HeapIterateOperation op(&blk);
+  VM_HeapIterateOperation op(&blk, parallel ? this : NULL);
   VMThread::execute(&op);
 }
 
@@ -1337,40 +1493,14 @@ jvmtiError JvmtiTagMap::get_objects_with_tags(const jlong* tags,
 // ObjectMarker is used to support the marking objects when walking the
 // heap.
 //
-// This implementation uses the existing mark bits in an object for
-// marking. Objects that are marked must later have their headers restored.
-// As most objects are unlocked and don't have their identity hash computed
-// we don't have to save their headers. Instead we save the headers that
-// are "interesting". Later when the headers are restored this implementation
-// restores all headers to their initial value and then restores the few
-// objects that had interesting headers.
+// This implementation records visited objects in a side bit set rather
+// than in the mark bits of the objects. Object headers are left untouched,
+// so the identity hash that keys the tag map stays readable during the
+// walk and there are no headers to restore when the walk is done.
 //
-// Future work: This implementation currently uses growable arrays to save
-// the oop and header of interesting objects. As an optimization we could
-// use the same technique as the GC and make use of the unused area
-// between top() and end().
-//
-
-// An ObjectClosure used to restore the mark bits of an object
-class RestoreMarksClosure : public ObjectClosure {
- public:
-  void do_object(oop o) {
-    if (o != NULL) {
-      markWord mark = o->mark();
-      if (mark.is_marked()) {
-        o->init_mark();
-      }
-    }
-  }
-};
-
-// ObjectMarker provides the mark and visited functions
 class ObjectMarker : AllStatic {
  private:
-  // saved headers
-  static GrowableArray<oop>* _saved_oop_stack;
-  static GrowableArray<markWord>* _saved_mark_stack;
-  static bool _needs_reset;                  // do we need to reset mark bits?
+  static ObjectBitSet<mtServiceability>* _bit_set;
 
  public:
   static void init();                       // initialize
@@ -1378,86 +1508,40 @@ class ObjectMarker : AllStatic {
 
   static inline void mark(oop o);           // mark an object
   static inline bool visited(oop o);        // check if object has been visited
-
-  static inline bool needs_reset()            { return _needs_reset; }
-  static inline void set_needs_reset(bool v)  { _needs_reset = v; }
 };
 
-GrowableArray<oop>* ObjectMarker::_saved_oop_stack = NULL;
-GrowableArray<markWord>* ObjectMarker::_saved_mark_stack = NULL;
-bool ObjectMarker::_needs_reset = true;  // need to reset mark bits by default
+ObjectBitSet<mtServiceability>* ObjectMarker::_bit_set = NULL;
 
 // initialize ObjectMarker - prepares for object marking
 void ObjectMarker::init() {
   assert(Thread::current()->is_VM_thread(), "must be VMThread");
   assert(SafepointSynchronize::is_at_safepoint(), "must be at a safepoint");
+  assert(_bit_set == NULL, "ObjectMarker already initialized");
 
-  // prepare heap for iteration
-  Universe::heap()->ensure_parsability(false);  // no need to retire TLABs
-
-  // create stacks for interesting headers
-  _saved_mark_stack = new (ResourceObj::C_HEAP, mtServiceability) GrowableArray<markWord>(4000, mtServiceability);
-  _saved_oop_stack = new (ResourceObj::C_HEAP, mtServiceability) GrowableArray<oop>(4000, mtServiceability);
-
-  if (UseBiasedLocking) {
-    BiasedLocking::preserve_marks();
-  }
+  _bit_set = new ObjectBitSet<mtServiceability>();
 }
 
-// Object marking is done so restore object headers
+// Object marking is done so release the bit set
 void ObjectMarker::done() {
-  // iterate over all objects and restore the mark bits to
-  // their initial value
-  RestoreMarksClosure blk;
-  if (needs_reset()) {
-    Universe::heap()->object_iterate(&blk);
-  } else {
-    // We don't need to reset mark bits on this call, but reset the
-    // flag to the default for the next call.
-    set_needs_reset(true);
-  }
-
-  // now restore the interesting headers
-  for (int i = 0; i < _saved_oop_stack->length(); i++) {
-    oop o = _saved_oop_stack->at(i);
-    markWord mark = _saved_mark_stack->at(i);
-    o->set_mark(mark);
-  }
-
-  if (UseBiasedLocking) {
-    BiasedLocking::restore_marks();
-  }
-
-  // free the stacks
-  delete _saved_oop_stack;
-  delete _saved_mark_stack;
+  delete _bit_set;
+  _bit_set = NULL;
 }
 
 // mark an object
 inline void ObjectMarker::mark(oop o) {
   assert(Universe::heap()->is_in(o), "sanity check");
-  assert(!o->mark().is_marked(), "should only mark an object once");
-
-  // object's mark word
-  markWord mark = o->mark();
-
-  if (o->mark_must_be_preserved(mark)) {
-    _saved_mark_stack->push(mark);
-    _saved_oop_stack->push(o);
-  }
-
-  // mark the object
-  o->set_mark(markWord::prototype().set_marked());
+  assert(!visited(o), "should only mark an object once");
+  _bit_set->mark_obj(o);
 }
 
 // return true if object is marked
 inline bool ObjectMarker::visited(oop o) {
-  return o->mark().is_marked();
+  return _bit_set->is_marked(o);
 }
 
 // Stack allocated class to help ensure that ObjectMarker is used
 // correctly. Constructor initializes ObjectMarker, destructor calls
-// ObjectMarker's done() function to restore object headers.
+// ObjectMarker's done() function to release the bit set.
 class ObjectMarkerController : public StackObj {
  public:
   ObjectMarkerController() {
@@ -2936,20 +3020,12 @@ void VM_HeapWalkOperation::doit() {
 
   // the heap walk starts with an initial object or the heap roots
   if (initial_object().is_null()) {
-    // If either collect_stack_roots() or collect_simple_roots()
-    // returns false at this point, then there are no mark bits
-    // to reset.
-    ObjectMarker::set_needs_reset(false);
-
     // Calling collect_stack_roots() before collect_simple_roots()
     // can result in a big performance boost for an agent that is
     // focused on analyzing references in the thread stacks.
     if (!collect_stack_roots()) return;
 
     if (!collect_simple_roots()) return;
-
-    // no early return so enable heap traversal to reset the mark bits
-    ObjectMarker::set_needs_reset(true);
   } else {
     visit_stack()->push(initial_object()());
   }
@@ -3018,21 +3094,6 @@ void JvmtiTagMap::follow_references(jint heap_filter,
   VMThread::execute(&op);
 }
 
-// Concurrent GC needs to call this in relocation pause, so after the objects are moved
-// and have their new addresses, the table can be rehashed.
-void JvmtiTagMap::set_needs_rehashing() {
-  assert(SafepointSynchronize::is_at_safepoint(), "called in gc pause");
-  assert(Thread::current()->is_VM_thread(), "should be the VM thread");
-
-  JvmtiEnvIterator it;
-  for (JvmtiEnv* env = it.first(); env != NULL; env = it.next(env)) {
-    JvmtiTagMap* tag_map = env->tag_map_acquire();
-    if (tag_map != NULL) {
-      tag_map->_needs_rehashing = true;
-    }
-  }
-}
-
 // Verify gc_notification follows set_needs_cleaning.
 DEBUG_ONLY(static bool notified_needs_cleaning = false;)
 
@@ -40,7 +40,6 @@ class JvmtiTagMap :  public CHeapObj<mtInternal> {
   JvmtiEnv*             _env;                       // the jvmti environment
   Mutex                 _lock;                      // lock for this tag map
   JvmtiTagMapTable*     _hashmap;                   // the hashmap for tags
-  bool                  _needs_rehashing;
   bool                  _needs_cleaning;
 
   static bool           _has_object_free_events;
@@ -93,10 +92,14 @@ class JvmtiTagMap :  public CHeapObj<mtInternal> {
 
 
   // advanced (JVMTI 1.1) heap iteration functions
+
+  // with parallel set the heap is iterated on the GC's safepoint workers
+  // and the callbacks may be invoked concurrently
   void iterate_through_heap(jint heap_filter,
                             Klass* klass,
                             const jvmtiHeapCallbacks* callbacks,
-                            const void* user_data);
+                            const void* user_data,
+                            bool parallel = false);
 
   void follow_references(jint heap_filter,
                          Klass* klass,
@@ -114,7 +117,6 @@ class JvmtiTagMap :  public CHeapObj<mtInternal> {
   void remove_dead_entries_locked(bool post_object_free);
 
   static void check_hashmaps_for_heapwalk();
-  static void set_needs_rehashing() NOT_JVMTI_RETURN;
   static void set_needs_cleaning() NOT_JVMTI_RETURN;
   static void gc_notification(size_t num_dead_entries) NOT_JVMTI_RETURN;
 
@@ -35,6 +35,7 @@
 #include "prims/jvmtiEventController.inline.hpp"
 #include "prims/jvmtiExport.hpp"
 #include "prims/jvmtiTagMapTable.hpp"
+#include "runtime/safepoint.hpp"
 #include "utilities/hashtable.inline.hpp"
 #include "utilities/macros.hpp"
 
@@ -83,9 +84,40 @@ void JvmtiTagMapTable::free_entry(JvmtiTagMapEntry* entry) {
   BasicHashtable<mtServiceability>::free_entry(entry);
 }
 
+// Entries are hashed by the identity hash of the object, which unlike its
+// address does not change when the GC moves the object. So the table never
+// has to be rehashed after a GC.
 unsigned int JvmtiTagMapTable::compute_hash(oop obj) {
   assert(obj != NULL, "obj is null");
-  return Universe::heap()->hash_oop(obj);
+  return (unsigned int)obj->identity_hash();
+}
+
+// Objects in the table all have an identity hash, so an object without one
+// cannot be tagged. Checking this first avoids installing a hash in every
+// object that is only looked up, e.g. during heap walks.
+bool JvmtiTagMapTable::has_no_hash(oop obj) {
+  const markWord mark = obj->mark();
+  return mark.has_bias_pattern() || (mark.is_neutral() && mark.has_no_hash());
+}
+
+// Returns the identity hash of obj, or markWord::no_hash if it has none,
+// without installing one. At a safepoint the header of a locked object is
+// read from its lock record or monitor, so heap walks, including those on
+// GC workers, never revoke a bias or inflate a monitor.
+unsigned int JvmtiTagMapTable::peek_hash(oop obj) {
+  markWord mark = obj->mark();
+  if (mark.has_bias_pattern()) {
+    return markWord::no_hash;
+  }
+  if (mark.has_displaced_mark_helper()) {
+    if (!SafepointSynchronize::is_at_safepoint()) {
+      // the lock may be released concurrently; the caller has already
+      // installed the hash, so this does not inflate
+      return compute_hash(obj);
+    }
+    mark = mark.displaced_mark_helper();
+  }
+  return (unsigned int)mark.hash();
 }
 
 JvmtiTagMapEntry* JvmtiTagMapTable::find(int index, unsigned int hash, oop obj) {
@@ -113,7 +145,10 @@ JvmtiTagMapEntry* JvmtiTagMapTable::find(int index, unsigned int hash, oop obj)
 }
 
 JvmtiTagMapEntry* JvmtiTagMapTable::find(oop obj) {
-  unsigned int hash = compute_hash(obj);
+  unsigned int hash = peek_hash(obj);
+  if (hash == markWord::no_hash) {
+    return NULL;
+  }
   int index = hash_to_index(hash);
   return find(index, hash, obj);
 }
@@ -142,7 +177,10 @@ JvmtiTagMapEntry* JvmtiTagMapTable::add(oop obj, jlong tag) {
 }
 
 void JvmtiTagMapTable::remove(oop obj) {
-  unsigned int hash = compute_hash(obj);
+  unsigned int hash = peek_hash(obj);
+  if (hash == markWord::no_hash) {
+    return;
+  }
   int index = hash_to_index(hash);
   JvmtiTagMapEntry** p = bucket_addr(index);
   JvmtiTagMapEntry* entry = bucket(index);
@@ -220,48 +258,3 @@ void JvmtiTagMapTable::remove_dead_entries(JvmtiEnv* env, bool post_object_free)
   log_info(jvmti, table) ("JvmtiTagMap entries counted %d removed %d; %s",
                           oops_counted, oops_removed, post_object_free ? "free object posted" : "no posting");
 }
-
-// Rehash oops in the table
-void JvmtiTagMapTable::rehash() {
-  ResourceMark rm;
-  GrowableArray<JvmtiTagMapEntry*> moved_entries;
-
-  int oops_counted = 0;
-  for (int i = 0; i < table_size(); ++i) {
-    JvmtiTagMapEntry** p = bucket_addr(i);
-    JvmtiTagMapEntry* entry = bucket(i);
-    while (entry != NULL) {
-      oops_counted++;
-      oop l = entry->object_no_keepalive();
-      if (l != NULL) {
-        // Check if oop has moved, ie its hashcode is different
-        // than the one entered in the table.
-        unsigned int new_hash = compute_hash(l);
-        if (entry->hash() != new_hash) {
-          *p = entry->next();
-          entry->set_hash(new_hash);
-          unlink_entry(entry);
-          moved_entries.push(entry);
-        } else {
-          p = entry->next_addr();
-        }
-      } else {
-        // Skip removed oops. They may still have to be posted.
-        p = entry->next_addr();
-      }
-      // get next entry
-      entry = *p;
-    }
-  }
-
-  int rehash_len = moved_entries.length();
-  // Now add back in the entries that were removed.
-  for (int i = 0; i < rehash_len; i++) {
-    JvmtiTagMapEntry* moved_entry = moved_entries.at(i);
-    int index = hash_to_index(moved_entry->hash());
-    Hashtable<WeakHandle, mtServiceability>::add_entry(index, moved_entry);
-  }
-
-  log_info(jvmti, table) ("JvmtiTagMap entries counted %d rehashed %d",
-                          oops_counted, rehash_len);
-}
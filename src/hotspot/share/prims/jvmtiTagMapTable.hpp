@@ -68,6 +68,7 @@ private:
   void free_entry(JvmtiTagMapEntry* entry);
 
   unsigned int compute_hash(oop obj);
+  unsigned int peek_hash(oop obj);
 
   JvmtiTagMapEntry* find(int index, unsigned int hash, oop obj);
 
@@ -77,6 +78,8 @@ public:
   JvmtiTagMapTable();
   ~JvmtiTagMapTable();
 
+  static bool has_no_hash(oop obj);
+
   JvmtiTagMapEntry* find(oop obj);
   JvmtiTagMapEntry* add(oop obj, jlong tag);
 
@@ -89,7 +92,6 @@ public:
 
   // Cleanup cleared entries and post
   void remove_dead_entries(JvmtiEnv* env, bool post_object_free);
-  void rehash();
   void clear();
 };
 
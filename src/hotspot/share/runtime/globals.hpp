@@ -866,6 +866,11 @@ const intx ObjectAlignmentInBytes = 8;
           "(Deprecated) Allow redefinition to add and delete private "      \
           "static or final methods for compatibility with old releases")    \
                                                                             \
+  product(bool, AlwaysRecordEvolDependencies, true, EXPERIMENTAL,           \
+          "Unconditionally record nmethod dependencies on class "           \
+          "redefinition, so that the first redefinition by an agent "       \
+          "attached at runtime only deoptimizes dependent code")            \
+                                                                            \
   develop(bool, TraceBytecodes, false,                                      \
           "Trace bytecode execution")                                       \
                                                                             \
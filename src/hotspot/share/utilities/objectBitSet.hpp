@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -22,8 +22,9 @@
  *
  */
 
-#ifndef SHARE_JFR_LEAKPROFILER_CHAINS_BITSET_HPP
-#define SHARE_JFR_LEAKPROFILER_CHAINS_BITSET_HPP
+
+#ifndef SHARE_UTILITIES_OBJECTBITSET_HPP
+#define SHARE_UTILITIES_OBJECTBITSET_HPP
 
 #include "memory/allocation.hpp"
 #include "oops/oop.hpp"
@@ -31,24 +32,34 @@
 #include "utilities/bitMap.hpp"
 #include "utilities/hashtable.hpp"
 
-class JfrVirtualMemory;
 class MemRegion;
 
-class BitSet : public CHeapObj<mtTracing> {
+/*
+ * ObjectBitSet is a sparse bitmap for marking objects in the Java heap.
+ * It holds one bit per possible object start address. To keep the footprint
+ * down when the heap is large, the bit storage is split into fragments,
+ * each covering one granule of the heap. Fragments are allocated on first
+ * use and kept in a hashtable keyed by granule.
+ */
+template<MEMFLAGS F>
+class ObjectBitSet : public CHeapObj<F> {
   const static size_t _bitmap_granularity_shift = 26; // 64M
   const static size_t _bitmap_granularity_size = (size_t)1 << _bitmap_granularity_shift;
   const static size_t _bitmap_granularity_mask = _bitmap_granularity_size - 1;
 
   class BitMapFragment;
+ public:
+  class ParMarker;
+ private:
 
-  class BitMapFragmentTable : public BasicHashtable<mtTracing> {
-    class Entry : public BasicHashtableEntry<mtTracing> {
+  class BitMapFragmentTable : public BasicHashtable<F> {
+    class Entry : public BasicHashtableEntry<F> {
     public:
       uintptr_t _key;
       CHeapBitMap* _value;
 
       Entry* next() {
-        return (Entry*)BasicHashtableEntry<mtTracing>::next();
+        return (Entry*)BasicHashtableEntry<F>::next();
       }
     };
 
@@ -63,25 +74,28 @@ class BitSet : public CHeapObj<mtTracing> {
     }
 
     unsigned hash_to_index(unsigned hash) {
-      return hash & (BasicHashtable<mtTracing>::table_size() - 1);
+      return hash & (BasicHashtable<F>::table_size() - 1);
     }
 
   public:
-    BitMapFragmentTable(int table_size) : BasicHashtable<mtTracing>(table_size, sizeof(Entry)) {}
+    BitMapFragmentTable(int table_size) : BasicHashtable<F>(table_size, sizeof(Entry)) {}
+    ~BitMapFragmentTable();
     void add(uintptr_t key, CHeapBitMap* value);
     CHeapBitMap** lookup(uintptr_t key);
   };
 
   CHeapBitMap* get_fragment_bits(uintptr_t addr);
+  CHeapBitMap* par_get_fragment_bits(uintptr_t addr);
 
   BitMapFragmentTable _bitmap_fragments;
   BitMapFragment* _fragment_list;
   CHeapBitMap* _last_fragment_bits;
   uintptr_t _last_fragment_granule;
+  volatile int _par_lock;
 
  public:
-  BitSet();
-  ~BitSet();
+  ObjectBitSet();
+  ~ObjectBitSet();
 
   BitMap::idx_t addr_to_bit(uintptr_t addr) const;
 
@@ -98,7 +112,28 @@ class BitSet : public CHeapObj<mtTracing> {
   }
 };
 
-class BitSet::BitMapFragment : public CHeapObj<mtTracing> {
+// Marks into an ObjectBitSet from a parallel worker. Each worker caches
+// the fragment it marked into last; looking up or creating a fragment
+// is serialized across workers.
+template<MEMFLAGS F>
+class ObjectBitSet<F>::ParMarker : public StackObj {
+  ObjectBitSet<F>* const _bit_set;
+  CHeapBitMap* _fragment_bits;
+  uintptr_t _fragment_granule;
+
+  CHeapBitMap* fragment_bits(uintptr_t addr);
+
+ public:
+  ParMarker(ObjectBitSet<F>* bit_set);
+
+  bool is_marked(oop obj);
+
+  // Returns true if this call marked the object
+  bool par_mark_obj(oop obj);
+};
+
+template<MEMFLAGS F>
+class ObjectBitSet<F>::BitMapFragment : public CHeapObj<F> {
   CHeapBitMap _bits;
   BitMapFragment* _next;
 
@@ -114,4 +149,4 @@ public:
   }
 };
 
-#endif // SHARE_JFR_LEAKPROFILER_CHAINS_BITSET_HPP
+#endif // SHARE_UTILITIES_OBJECTBITSET_HPP
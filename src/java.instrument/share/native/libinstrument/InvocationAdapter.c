@@ -105,10 +105,13 @@ getBooleanAttribute(const jarAttribute* attributes, const char* name) {
 
 /*
  * Parse any capability settings in the JAR manifest and
- * convert them to JVM TI capabilities.
+ * convert them to JVM TI capabilities. Also records the
+ * Transform-Class-Prefixes filter for the transformers.
  */
 void
 convertCapabilityAttributes(const jarAttribute* attributes, JPLISAgent* agent) {
+    char* transformClassPrefixes;
+
     /* set redefineClasses capability */
     if (getBooleanAttribute(attributes, "Can-Redefine-Classes")) {
         addRedefineClassesCapability(agent);
@@ -128,6 +131,12 @@ convertCapabilityAttributes(const jarAttribute* attributes, JPLISAgent* agent) {
     if (getBooleanAttribute(attributes, "Can-Maintain-Original-Method-Order")) {
         addOriginalMethodOrderCapability(agent);
     }
+
+    /* skip the transformers for classes that match none of these prefixes */
+    transformClassPrefixes = getAttribute(attributes, "Transform-Class-Prefixes");
+    if (transformClassPrefixes != NULL) {
+        setTransformClassPrefixes(agent, transformClassPrefixes);
+    }
 }
 
 /*
@@ -170,6 +170,12 @@ redefineClassMapper(    JNIEnv *    jnienv,
 jobjectArray
 getObjectArrayFromClasses(JNIEnv* jnienv, jclass* classes, jint classCount);
 
+/* Tells if the transformers should be called for the class, according to
+ * the agent's Transform-Class-Prefixes.
+ */
+jboolean
+isTransformClassName(JPLISAgent * agent, const char * name, jclass classBeingRedefined);
+
 
 JPLISEnvironment *
 getJPLISEnvironment(jvmtiEnv * jvmtienv) {
@@ -273,6 +279,8 @@ initializeJPLISAgent(   JPLISAgent *    agent,
     agent->mAgentClassName                           = NULL;
     agent->mOptionsString                            = NULL;
     agent->mJarfile                                  = NULL;
+    agent->mTransformClassPrefixes                   = NULL;        /* no filter, transform all classes */
+    agent->mTransformClassPrefixCount                = 0;
 
     /* make sure we can recover either handle in either direction.
      * the agent has a ref to the jvmti; make it mutual
@@ -814,8 +822,11 @@ transformClassFile(             JPLISAgent *            agent,
     unsigned char * resultBuffer            = NULL;
     jboolean        shouldRun               = JNI_FALSE;
 
-    /* only do this if we aren't already in the middle of processing a class on this thread */
-    shouldRun = tryToAcquireReentrancyToken(
+    /* only do this if the transformers want to see the class and
+     * we aren't already in the middle of processing a class on this thread
+     */
+    shouldRun = isTransformClassName(agent, name, classBeingRedefined) &&
+                tryToAcquireReentrancyToken(
                                 jvmti(agent),
                                 NULL);  /* this thread */
 
@@ -930,6 +941,96 @@ transformClassFile(             JPLISAgent *            agent,
  *  Misc. internal utilities.
  */
 
+/*
+ *  Record the Transform-Class-Prefixes of the agent. The prefixes may be
+ *  given in binary (java.lang.) or internal (java/lang/) form; they are
+ *  stored in internal form to match the names passed to ClassFileLoadHook.
+ */
+void
+setTransformClassPrefixes(JPLISAgent * agent, const char * prefixList) {
+    char *      ourCopyOfPrefixList = NULL;
+    char **     prefixes            = NULL;
+    jint        prefixCount         = 0;
+    char *      p                   = NULL;
+    jint        i                   = 0;
+
+    ourCopyOfPrefixList = allocate(jvmti(agent), strlen(prefixList)+1);
+    if (ourCopyOfPrefixList == NULL) {
+        return;     /* no filter, the transformers see all classes */
+    }
+    strcpy(ourCopyOfPrefixList, prefixList);
+
+    /* count the prefixes */
+    p = ourCopyOfPrefixList;
+    while (*p != '\0') {
+        while (*p == ' ' || *p == '\t') {
+            p++;
+        }
+        if (*p == '\0') {
+            break;
+        }
+        prefixCount++;
+        while (*p != '\0' && *p != ' ' && *p != '\t') {
+            p++;
+        }
+    }
+
+    if (prefixCount > 0) {
+        prefixes = allocate(jvmti(agent), prefixCount * sizeof(char *));
+    }
+    if (prefixes == NULL) {
+        deallocate(jvmti(agent), ourCopyOfPrefixList);
+        return;
+    }
+
+    /* split the list in place, converting to internal form */
+    p = ourCopyOfPrefixList;
+    while (i < prefixCount) {
+        while (*p == ' ' || *p == '\t') {
+            p++;
+        }
+        prefixes[i++] = p;
+        while (*p != '\0' && *p != ' ' && *p != '\t') {
+            if (*p == '.') {
+                *p = '/';
+            }
+            p++;
+        }
+        if (*p != '\0') {
+            *p++ = '\0';
+        }
+    }
+
+    agent->mTransformClassPrefixes = prefixes;
+    agent->mTransformClassPrefixCount = prefixCount;
+}
+
+/*
+ *  Tells if a class should be passed to the transformers. Classes being
+ *  loaded are skipped if the agent has declared Transform-Class-Prefixes
+ *  and the name matches none of them; that saves the upcall and copying
+ *  the class file bytes in and out of the Java heap. Redefinition and
+ *  retransformation are explicit requests and are never filtered.
+ */
+jboolean
+isTransformClassName(JPLISAgent * agent, const char * name, jclass classBeingRedefined) {
+    jint i;
+
+    if (agent->mTransformClassPrefixes == NULL || classBeingRedefined != NULL) {
+        return JNI_TRUE;
+    }
+    if (name == NULL) {
+        return JNI_FALSE;
+    }
+    for (i = 0; i < agent->mTransformClassPrefixCount; i++) {
+        const char * prefix = agent->mTransformClassPrefixes[i];
+        if (strncmp(name, prefix, strlen(prefix)) == 0) {
+            return JNI_TRUE;
+        }
+    }
+    return JNI_FALSE;
+}
+
 /*
  *  The only checked exceptions we can throw are ClassNotFoundException and
  *  UnmodifiableClassException. All others map to InternalError.
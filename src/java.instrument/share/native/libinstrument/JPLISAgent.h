@@ -108,6 +108,8 @@ struct _JPLISAgent {
     char const *            mAgentClassName;        /* agent class name */
     char const *            mOptionsString;         /* -javaagent options string */
     const char *            mJarfile;               /* agent jar file name */
+    char **                 mTransformClassPrefixes;     /* class name prefixes the transformers are restricted to, or NULL */
+    jint                    mTransformClassPrefixCount;  /* number of entries in mTransformClassPrefixes */
 };
 
 /*
@@ -165,6 +167,12 @@ addNativeMethodPrefixCapability(JPLISAgent * agent);
 extern void
 addOriginalMethodOrderCapability(JPLISAgent * agent);
 
+/* Restricts the transformers to classes whose names start with one of the
+ * space separated prefixes in prefixList (Transform-Class-Prefixes attribute)
+ */
+extern void
+setTransformClassPrefixes(JPLISAgent * agent, const char * prefixList);
+
 
 /* Our JPLIS agent is paralleled by a Java InstrumentationImpl instance.
  * This routine uses JNI to create and initialized the Java instance.
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2016, 2020, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/z/zAddress.inline.hpp"
+#include "gc/z/zArray.inline.hpp"
+#include "gc/z/zGlobals.hpp"
+#include "gc/z/zPage.inline.hpp"
+#include "gc/z/zRelocationSetSelector.inline.hpp"
+#include "runtime/flags/flagSetting.hpp"
+#include "runtime/globals.hpp"
+#include "unittest.hpp"
+
+class ZRelocationSetSelectorTest : public ::testing::Test {
+public:
+  static const size_t aged_live = 10 * 16;
+  // Dense young pages are deferred, sparse ones are relocated right away
+  static const size_t young_dense_live = ZPageSizeSmall / 2;
+  static const size_t young_sparse_live = 100 * 16;
+  static const size_t young_live = young_dense_live + young_sparse_live;
+  static const size_t deferrable_garbage = ZPageSizeSmall - young_dense_live;
+
+  // Aged pages are allocated one GC cycle before young pages
+  class Pages {
+  private:
+    const ZVirtualMemory _vmem;
+    const ZPhysicalMemory _pmem;
+    ZPage _aged0;
+    ZPage _aged1;
+    ZPage _young0;
+    ZPage _young1;
+
+    static void mark(ZPage* page, size_t live_bytes) {
+      const size_t object_size = 16;
+      const uintptr_t object = page->alloc_object(object_size);
+
+      bool dummy = false;
+      page->mark_object(ZAddress::marked(object), dummy, dummy);
+      page->inc_live((uint32_t)(live_bytes / object_size), live_bytes);
+    }
+
+  public:
+    Pages() :
+        _vmem(0, ZPageSizeSmall),
+        _pmem(ZPhysicalMemorySegment(0, ZPageSizeSmall, true)),
+        _aged0(ZPageTypeSmall, _vmem, _pmem),
+        _aged1(ZPageTypeSmall, _vmem, _pmem),
+        _young0(ZPageTypeSmall, _vmem, _pmem),
+        _young1(ZPageTypeSmall, _vmem, _pmem) {
+      _aged0.reset();
+      _aged1.reset();
+
+      ZGlobalSeqNum++;
+
+      _young0.reset();
+      _young1.reset();
+
+      ZGlobalSeqNum++;
+
+      mark(&_aged0, aged_live);
+      mark(&_aged1, aged_live);
+      mark(&_young0, young_dense_live);
+      mark(&_young1, young_sparse_live);
+    }
+
+    template <typename T>
+    void register_live_pages(T* selector) {
+      selector->register_live_page(&_aged0);
+      selector->register_live_page(&_young0);
+      selector->register_live_page(&_aged1);
+      selector->register_live_page(&_young1);
+    }
+  };
+
+  static void test_defer_young_pages() {
+    Pages pages;
+    ZRelocationSetSelectorGroup group("Small", ZPageTypeSmall, ZPageSizeSmall, ZObjectSizeLimitSmall);
+    pages.register_live_pages(&group);
+
+    ASSERT_EQ(group._live_pages.length(), 4);
+    EXPECT_EQ(group.selected_young_live(), young_live);
+    EXPECT_EQ(group.deferrable_garbage(), deferrable_garbage);
+
+    group.defer_young_pages();
+
+    // The aged pages and the sparse young page remain, in their original order
+    ASSERT_EQ(group._live_pages.length(), 3);
+    EXPECT_EQ(group._live_pages.at(0)->age(), 2u);
+    EXPECT_EQ(group._live_pages.at(1)->age(), 2u);
+    EXPECT_EQ(group._live_pages.at(2)->age(), 1u);
+    EXPECT_EQ(group.selected_young_live(), young_sparse_live);
+    EXPECT_EQ(group.deferrable_garbage(), 0u);
+  }
+
+  static void test_should_defer_young_pages() {
+    const size_t saved_young_live_last = ZRelocationSetSelector::_young_live_last;
+    FlagSetting fs(ZRelocationDeferYoungPages, true);
+
+    Pages pages;
+    ZRelocationSetSelector selector;
+    pages.register_live_pages(&selector);
+
+    EXPECT_EQ(selector._young_live, young_live);
+    EXPECT_EQ(selector._aged_live, 2 * aged_live);
+
+    const size_t soft_max_capacity = 64 * M;
+
+    // No history
+    ZRelocationSetSelector::_young_live_last = 0;
+    EXPECT_FALSE(selector.should_defer_young_pages(0, soft_max_capacity));
+
+    // 10% survival, deferred garbage within a quarter of the headroom
+    ZRelocationSetSelector::_young_live_last = 2 * aged_live * 10;
+    EXPECT_TRUE(selector.should_defer_young_pages(0, soft_max_capacity));
+    EXPECT_TRUE(selector.should_defer_young_pages(soft_max_capacity / 2, soft_max_capacity));
+    EXPECT_TRUE(selector.should_defer_young_pages(soft_max_capacity - 4 * deferrable_garbage, soft_max_capacity));
+
+    // 10% survival, insufficient headroom
+    EXPECT_FALSE(selector.should_defer_young_pages(soft_max_capacity - 4 * deferrable_garbage + 1, soft_max_capacity));
+    EXPECT_FALSE(selector.should_defer_young_pages(soft_max_capacity, soft_max_capacity));
+    EXPECT_FALSE(selector.should_defer_young_pages(soft_max_capacity + M, soft_max_capacity));
+
+    // 80% survival
+    ZRelocationSetSelector::_young_live_last = 2 * aged_live * 100 / 80;
+    EXPECT_FALSE(selector.should_defer_young_pages(0, soft_max_capacity));
+
+    // Disabled
+    {
+      FlagSetting fs_disabled(ZRelocationDeferYoungPages, false);
+      ZRelocationSetSelector::_young_live_last = 2 * aged_live * 10;
+      EXPECT_FALSE(selector.should_defer_young_pages(0, soft_max_capacity));
+    }
+
+    ZRelocationSetSelector::_young_live_last = saved_young_live_last;
+  }
+};
+
+TEST_F(ZRelocationSetSelectorTest, defer_young_pages) {
+  test_defer_young_pages();
+}
+
+TEST_F(ZRelocationSetSelectorTest, should_defer_young_pages) {
+  test_should_defer_young_pages();
+}
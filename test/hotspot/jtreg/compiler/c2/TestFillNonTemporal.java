@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Fill loops turned into fill stub calls with OptimizeFill must fill
+ *          exactly the requested range, including fills that use non-temporal
+ *          stores and have an unaligned head and tail.
+ * @requires os.arch=="amd64" | os.arch=="x86_64"
+ * @requires vm.compiler2.enabled
+ *
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:+OptimizeFill
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:NonTemporalFillThreshold=4096
+ *                   compiler.c2.TestFillNonTemporal
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:+OptimizeFill -Xmx256m
+ *                   compiler.c2.TestFillNonTemporal large
+ */
+
+package compiler.c2;
+
+import java.util.Arrays;
+
+public class TestFillNonTemporal {
+
+    private static final int WARMUP = 20_000;
+
+    // Covers small fills, fills just below and above the forced 4096 byte
+    // threshold, and fills well above it.
+    private static final int[] SIZES_BYTES = {
+        1, 31, 63, 255, 256, 4000, 4095, 4096, 4097, 4159, 4160, 8191, 65536 + 17, 1024 * 1024 + 3,
+    };
+
+    // Larger than the default threshold, which is 3/4 of the last level cache
+    private static final int LARGE_BYTES = 96 * 1024 * 1024;
+
+    static void fill(byte[] a, int from, int to, byte v) {
+        for (int i = from; i < to; i++) {
+            a[i] = v;
+        }
+    }
+
+    static void fill(short[] a, int from, int to, short v) {
+        for (int i = from; i < to; i++) {
+            a[i] = v;
+        }
+    }
+
+    static void fill(int[] a, int from, int to, int v) {
+        for (int i = from; i < to; i++) {
+            a[i] = v;
+        }
+    }
+
+    private static void check(boolean ok, String what, int length, int from, int to, int i) {
+        if (!ok) {
+            throw new RuntimeException(what + ": wrong value at " + i + " after filling [" + from + ", " + to +
+                                       ") of " + length + " elements");
+        }
+    }
+
+    private static void testBytes(int size, int maxOffset) {
+        for (int head = 0; head < maxOffset; head += 3) {
+            for (int tail = 0; tail < maxOffset; tail += 7) {
+                byte[] a = new byte[head + size + tail];
+                Arrays.fill(a, (byte)0x5a);
+                fill(a, head, head + size, (byte)0x11);
+                for (int i = 0; i < a.length; i++) {
+                    boolean inside = i >= head && i < head + size;
+                    check(a[i] == (inside ? (byte)0x11 : (byte)0x5a), "byte", a.length, head, head + size, i);
+                }
+            }
+        }
+    }
+
+    private static void testShorts(int size, int maxOffset) {
+        for (int head = 0; head < maxOffset; head += 3) {
+            for (int tail = 0; tail < maxOffset; tail += 7) {
+                short[] a = new short[head + size + tail];
+                Arrays.fill(a, (short)0x5a5a);
+                fill(a, head, head + size, (short)0x1122);
+                for (int i = 0; i < a.length; i++) {
+                    boolean inside = i >= head && i < head + size;
+                    check(a[i] == (inside ? (short)0x1122 : (short)0x5a5a), "short", a.length, head, head + size, i);
+                }
+            }
+        }
+    }
+
+    private static void testInts(int size, int maxOffset) {
+        for (int head = 0; head < maxOffset; head += 3) {
+            for (int tail = 0; tail < maxOffset; tail += 7) {
+                int[] a = new int[head + size + tail];
+                Arrays.fill(a, 0x5a5a5a5a);
+                fill(a, head, head + size, 0x11223344);
+                for (int i = 0; i < a.length; i++) {
+                    boolean inside = i >= head && i < head + size;
+                    check(a[i] == (inside ? 0x11223344 : 0x5a5a5a5a), "int", a.length, head, head + size, i);
+                }
+            }
+        }
+    }
+
+    public static void main(String[] args) {
+        // Compile the fill loops into fill stub calls
+        byte[] b = new byte[64];
+        short[] s = new short[64];
+        int[] n = new int[64];
+        for (int i = 0; i < WARMUP; i++) {
+            fill(b, i & 7, 64, (byte)i);
+            fill(s, i & 7, 64, (short)i);
+            fill(n, i & 7, 64, i);
+        }
+
+        if (args.length > 0 && args[0].equals("large")) {
+            testBytes(LARGE_BYTES + 5, 8);
+            testInts(LARGE_BYTES / 4 + 5, 8);
+            return;
+        }
+
+        for (int size : SIZES_BYTES) {
+            testBytes(size, 40);
+            testShorts((size + 1) / 2, 20);
+            testInts((size + 3) / 4, 10);
+        }
+    }
+}
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary StrictMath sin, cos, tan, log and log10 must return bit-exact
+ *          fdlibm results in the interpreter and in C1 and C2 compiled code.
+ *
+ * @run main/othervm -Xint compiler.floatingpoint.TestStrictMathFdlibm
+ * @run main/othervm -Xbatch -XX:TieredStopAtLevel=1 compiler.floatingpoint.TestStrictMathFdlibm
+ * @run main/othervm -Xbatch -XX:-TieredCompilation compiler.floatingpoint.TestStrictMathFdlibm
+ */
+
+package compiler.floatingpoint;
+
+public class TestStrictMathFdlibm {
+
+    private static final int ITERATIONS = 20_000;
+
+    // { input bits, expected result bits } pairs, computed with the fdlibm
+    // sources in src/java.base/share/native/libfdlibm.
+    private static final long[][] SIN = {
+        { 0x0000000000000000L, 0x0000000000000000L },
+        { 0x8000000000000000L, 0x8000000000000000L },
+        { 0x7ff8000000000000L, 0x7ff8000000000000L },
+        { 0x7ff0000000000000L, 0xfff8000000000000L },
+        { 0xfff0000000000000L, 0xfff8000000000000L },
+        { 0x0000000000000001L, 0x0000000000000001L },
+        { 0x8000000000000001L, 0x8000000000000001L },
+        { 0x0010000000000000L, 0x0010000000000000L },
+        { 0x3e45798ee2308c3aL, 0x3e45798ee2308c3aL },
+        { 0x3e50000000000000L, 0x3e50000000000000L },
+        { 0x3fe0000000000000L, 0x3fdeaee8744b05f0L },
+        { 0x3ff0000000000000L, 0x3feaed548f090ceeL },
+        { 0xbff0000000000000L, 0xbfeaed548f090ceeL },
+        { 0x3fe921fb54442d18L, 0x3fe6a09e667f3bccL },
+        { 0x3ff921fb54442d18L, 0x3ff0000000000000L },
+        { 0x400921fb54442d18L, 0x3ca1a62633145c07L },
+        { 0x401921fb54442d18L, 0xbcb1a62633145c07L },
+        { 0x4012d97c7f3321d2L, 0xbff0000000000000L },
+        { 0x4002d97c7f3321d2L, 0x3fe6a09e667f3bcdL },
+        { 0x412e848000000000L, 0xbfd6664b2568d867L },
+        { 0x413921fb54442d18L, 0xbdd1a62633145c07L },
+        { 0x44b52d02c7e14af6L, 0xbfd4bd4cba14452eL },
+        { 0x7e37e43c8800759cL, 0xbfea2c16b010e385L },
+        { 0x7fefffffffffffffL, 0x3f7452fc98b34e97L },
+        { 0xffefffffffffffffL, 0xbf7452fc98b34e97L },
+        { 0x7fe0000000000000L, 0x3fe205248cbdb760L },
+        { 0x4346dcc9a6f40000L, 0x3fef1f207aba55d7L },
+    };
+
+    private static final long[][] COS = {
+        { 0x0000000000000000L, 0x3ff0000000000000L },
+        { 0x8000000000000000L, 0x3ff0000000000000L },
+        { 0x7ff8000000000000L, 0x7ff8000000000000L },
+        { 0x7ff0000000000000L, 0xfff8000000000000L },
+        { 0xfff0000000000000L, 0xfff8000000000000L },
+        { 0x0000000000000001L, 0x3ff0000000000000L },
+        { 0x8000000000000001L, 0x3ff0000000000000L },
+        { 0x0010000000000000L, 0x3ff0000000000000L },
+        { 0x3e45798ee2308c3aL, 0x3ff0000000000000L },
+        { 0x3e50000000000000L, 0x3fefffffffffffffL },
+        { 0x3fe0000000000000L, 0x3fec1528065b7d50L },
+        { 0x3ff0000000000000L, 0x3fe14a280fb5068cL },
+        { 0xbff0000000000000L, 0x3fe14a280fb5068cL },
+        { 0x3fe921fb54442d18L, 0x3fe6a09e667f3bcdL },
+        { 0x3ff921fb54442d18L, 0x3c91a62633145c07L },
+        { 0x400921fb54442d18L, 0xbff0000000000000L },
+        { 0x401921fb54442d18L, 0x3ff0000000000000L },
+        { 0x4012d97c7f3321d2L, 0xbcaa79394c9e8a0aL },
+        { 0x4002d97c7f3321d2L, 0xbfe6a09e667f3bccL },
+        { 0x412e848000000000L, 0x3fedf9df9906d32cL },
+        { 0x413921fb54442d18L, 0x3ff0000000000000L },
+        { 0x44b52d02c7e14af6L, 0x3fee45f2c19a7c81L },
+        { 0x7e37e43c8800759cL, 0xbfe2699022adc4c1L },
+        { 0x7fefffffffffffffL, 0xbfefffe62ecfab75L },
+        { 0xffefffffffffffffL, 0xbfefffe62ecfab75L },
+        { 0x7fe0000000000000L, 0xbfea719f26c232beL },
+        { 0x4346dcc9a6f40000L, 0xbfcdc8f66b813531L },
+    };
+
+    private static final long[][] TAN = {
+        { 0x0000000000000000L, 0x0000000000000000L },
+        { 0x8000000000000000L, 0x8000000000000000L },
+        { 0x7ff8000000000000L, 0x7ff8000000000000L },
+        { 0x7ff0000000000000L, 0xfff8000000000000L },
+        { 0xfff0000000000000L, 0xfff8000000000000L },
+        { 0x0000000000000001L, 0x0000000000000001L },
+        { 0x8000000000000001L, 0x8000000000000001L },
+        { 0x0010000000000000L, 0x0010000000000000L },
+        { 0x3e45798ee2308c3aL, 0x3e45798ee2308c3aL },
+        { 0x3e50000000000000L, 0x3e50000000000000L },
+        { 0x3fe0000000000000L, 0x3fe17b4f5bf3474aL },
+        { 0x3ff0000000000000L, 0x3ff8eb245cbee3a6L },
+        { 0xbff0000000000000L, 0xbff8eb245cbee3a6L },
+        { 0x3fe921fb54442d18L, 0x3fefffffffffffffL },
+        { 0x3ff921fb54442d18L, 0x434d02967c31cdb5L },
+        { 0x400921fb54442d18L, 0xbca1a62633145c07L },
+        { 0x401921fb54442d18L, 0xbcb1a62633145c07L },
+        { 0x4012d97c7f3321d2L, 0x4333570efd768923L },
+        { 0x4002d97c7f3321d2L, 0xbff0000000000001L },
+        { 0x412e848000000000L, 0xbfd7e9768ab734c0L },
+        { 0x413921fb54442d18L, 0xbdd1a62633145c07L },
+        { 0x44b52d02c7e14af6L, 0xbfd5ec237697ce49L },
+        { 0x7e37e43c8800759cL, 0x3ff6be411f37ac77L },
+        { 0x7fefffffffffffffL, 0xbf74530cfe729484L },
+        { 0xffefffffffffffffL, 0x3f74530cfe729484L },
+        { 0x7fe0000000000000L, 0xbfe5ce6b4c0d02a3L },
+        { 0x4346dcc9a6f40000L, 0xc010b7ce095916b2L },
+    };
+
+    private static final long[][] LOG = {
+        { 0x0000000000000000L, 0xfff0000000000000L },
+        { 0x8000000000000000L, 0xfff0000000000000L },
+        { 0xbff0000000000000L, 0xfff8000000000000L },
+        { 0x7ff8000000000000L, 0x7ff8000000000000L },
+        { 0x7ff0000000000000L, 0x7ff0000000000000L },
+        { 0xfff0000000000000L, 0xfff8000000000000L },
+        { 0x0000000000000001L, 0xc0874385446d71c3L },
+        { 0x0010000000000000L, 0xc086232bdd7abcd2L },
+        { 0x3ff0000000000000L, 0x0000000000000000L },
+        { 0x3ff0000000000001L, 0x3cafffffffffffffL },
+        { 0x3fefffffffffffffL, 0xbca0000000000000L },
+        { 0x4024000000000000L, 0x40026bb1bbb55516L },
+        { 0x4059000000000000L, 0x40126bb1bbb55516L },
+        { 0x44b52d02c7e14af6L, 0x404a7acf7dd4aa4fL },
+        { 0x4000000000000000L, 0x3fe62e42fefa39efL },
+        { 0x4005bf0a8b145769L, 0x3ff0000000000000L },
+        { 0x3fe0000000000000L, 0xbfe62e42fefa39efL },
+        { 0x3fb999999999999aL, 0xc0026bb1bbb55515L },
+        { 0x7fefffffffffffffL, 0x40862e42fefa39efL },
+        { 0x01a56e1fc2f8f359L, 0xc085963447f87fb5L },
+        { 0x3ff8000000000000L, 0x3fd9f323ecbf984cL },
+        { 0x3ff6a09e667f3bcdL, 0x3fd62e42fefa39f0L },
+    };
+
+    private static final long[][] LOG10 = {
+        { 0x0000000000000000L, 0xfff0000000000000L },
+        { 0x8000000000000000L, 0xfff0000000000000L },
+        { 0xbff0000000000000L, 0xfff8000000000000L },
+        { 0x7ff8000000000000L, 0x7ff8000000000000L },
+        { 0x7ff0000000000000L, 0x7ff0000000000000L },
+        { 0xfff0000000000000L, 0xfff8000000000000L },
+        { 0x0000000000000001L, 0xc07434e6420f4374L },
+        { 0x0010000000000000L, 0xc0733a7146f72a42L },
+        { 0x3ff0000000000000L, 0x0000000000000000L },
+        { 0x3ff0000000000001L, 0x3c9bcb7b1526e50dL },
+        { 0x3fefffffffffffffL, 0xbc8bcb7b1526e50eL },
+        { 0x4024000000000000L, 0x3ff0000000000000L },
+        { 0x4059000000000000L, 0x4000000000000000L },
+        { 0x44b52d02c7e14af6L, 0x4037000000000000L },
+        { 0x4000000000000000L, 0x3fd34413509f79ffL },
+        { 0x4005bf0a8b145769L, 0x3fdbcb7b1526e50eL },
+        { 0x3fe0000000000000L, 0xbfd34413509f79ffL },
+        { 0x3fb999999999999aL, 0xbff0000000000000L },
+        { 0x7fefffffffffffffL, 0x40734413509f79ffL },
+        { 0x01a56e1fc2f8f359L, 0xc072c00000000000L },
+        { 0x3ff8000000000000L, 0x3fc68a288b60b7fcL },
+        { 0x3ff6a09e667f3bcdL, 0x3fc34413509f79ffL },
+    };
+
+    static double sin(double x)   { return StrictMath.sin(x); }
+    static double cos(double x)   { return StrictMath.cos(x); }
+    static double tan(double x)   { return StrictMath.tan(x); }
+    static double log(double x)   { return StrictMath.log(x); }
+    static double log10(double x) { return StrictMath.log10(x); }
+
+    static double apply(String name, double x) {
+        switch (name) {
+            case "sin":   return sin(x);
+            case "cos":   return cos(x);
+            case "tan":   return tan(x);
+            case "log":   return log(x);
+            case "log10": return log10(x);
+            default: throw new IllegalArgumentException(name);
+        }
+    }
+
+    static int check(String name, long[][] cases) {
+        int failures = 0;
+        for (long[] c : cases) {
+            double x = Double.longBitsToDouble(c[0]);
+            double expected = Double.longBitsToDouble(c[1]);
+            double result = apply(name, x);
+            // Double.compare distinguishes -0.0 from 0.0 and treats all NaNs as equal
+            if (Double.compare(result, expected) != 0) {
+                System.out.println("StrictMath." + name + "(" + x + " [0x" + Long.toHexString(c[0]) + "]) = " +
+                                   result + " [0x" + Long.toHexString(Double.doubleToRawLongBits(result)) +
+                                   "], expected " + expected + " [0x" + Long.toHexString(c[1]) + "]");
+                failures++;
+            }
+        }
+        return failures;
+    }
+
+    public static void main(String[] args) {
+        // Run enough iterations to get the callers compiled when a JIT is used
+        for (int i = 0; i < ITERATIONS; i++) {
+            int failures = check("sin", SIN) + check("cos", COS) + check("tan", TAN) +
+                           check("log", LOG) + check("log10", LOG10);
+            if (failures != 0) {
+                throw new RuntimeException(failures + " StrictMath results differ from fdlibm in iteration " + i);
+            }
+        }
+    }
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Math.tan must stay within 1 ulp of StrictMath.tan and handle special
+ *          values in the interpreter and in C1 and C2 compiled code.
+ * @key randomness
+ * @library /test/lib
+ *
+ * @run main/othervm -Xint compiler.intrinsics.math.TestTanIntrinsic
+ * @run main/othervm -Xbatch -XX:TieredStopAtLevel=1 compiler.intrinsics.math.TestTanIntrinsic
+ * @run main/othervm -Xbatch -XX:-TieredCompilation compiler.intrinsics.math.TestTanIntrinsic
+ */
+
+package compiler.intrinsics.math;
+
+import java.util.Random;
+
+import jdk.test.lib.Utils;
+
+public class TestTanIntrinsic {
+
+    private static final int ITERATIONS = 20_000;
+
+    private static final double[] SPECIAL = {
+        // Signed zeros and tiny arguments, where tan(x) == x
+        0.0, -0.0, Double.MIN_VALUE, -Double.MIN_VALUE, Double.MIN_NORMAL, 0x1.0p-28, -0x1.0p-28,
+        // Multiples of pi/4 and pi/2, around the poles
+        Math.PI / 4, -Math.PI / 4, Math.PI / 2, -Math.PI / 2, Math.nextUp(Math.PI / 2), Math.nextDown(Math.PI / 2),
+        Math.PI, -Math.PI, 3 * Math.PI / 2, 2 * Math.PI, 100 * Math.PI, 1e6 * Math.PI / 2,
+        // Boundaries of the argument reduction paths
+        0.6744, 0x1.921fb54442d18p+2, 0x1.2d97c7f3321d2p+2, 0x1.921fb6p+19, 0x1.921fb6p+20,
+        // Large arguments that need full argument reduction
+        1e22, 1e300, 0x1.0p1000, -0x1.0p1000, Double.MAX_VALUE, -Double.MAX_VALUE,
+    };
+
+    private static double tan(double x) {
+        return Math.tan(x);
+    }
+
+    private static void check(double x) {
+        double actual = tan(x);
+        double expected = StrictMath.tan(x);
+
+        if (Double.isNaN(expected)) {
+            if (!Double.isNaN(actual)) {
+                throw new RuntimeException("tan(" + x + ") = " + actual + ", expected NaN");
+            }
+            return;
+        }
+
+        if (expected == 0.0) {
+            // Sign of zero must be preserved
+            if (Double.doubleToRawLongBits(actual) != Double.doubleToRawLongBits(expected)) {
+                throw new RuntimeException("tan(" + x + ") = " + actual + ", expected " + expected);
+            }
+            return;
+        }
+
+        if (Math.abs(actual - expected) > Math.ulp(expected)) {
+            throw new RuntimeException("tan(" + x + ") = " + actual + " (" + Double.toHexString(actual) +
+                                       "), expected " + expected + " (" + Double.toHexString(expected) +
+                                       ") within 1 ulp");
+        }
+    }
+
+    private static void checkNaN(double x) {
+        double actual = tan(x);
+        if (!Double.isNaN(actual)) {
+            throw new RuntimeException("tan(" + x + ") = " + actual + ", expected NaN");
+        }
+    }
+
+    public static void main(String[] args) {
+        Random random = Utils.getRandomInstance();
+
+        // Run often enough for tan() to be compiled with -Xbatch
+        for (int i = 0; i < ITERATIONS; i++) {
+            for (double x : SPECIAL) {
+                check(x);
+                check(-x);
+            }
+
+            checkNaN(Double.NaN);
+            checkNaN(Double.POSITIVE_INFINITY);
+            checkNaN(Double.NEGATIVE_INFINITY);
+
+            // Small arguments, where most calls end up
+            check((random.nextDouble() - 0.5) * 4 * Math.PI);
+            // Arbitrary finite arguments
+            check(Double.longBitsToDouble(random.nextLong() & 0x7fefffffffffffffL));
+        }
+    }
+}
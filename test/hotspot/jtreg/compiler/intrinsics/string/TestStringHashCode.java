@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary String.hashCode must match the specified polynomial for Latin-1
+ *          and UTF-16 strings in the interpreter and in compiled code.
+ * @key randomness
+ * @library /test/lib
+ *
+ * @run main/othervm -Xint compiler.intrinsics.string.TestStringHashCode
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:+CompactStrings
+ *                   compiler.intrinsics.string.TestStringHashCode
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:-CompactStrings
+ *                   compiler.intrinsics.string.TestStringHashCode
+ */
+
+package compiler.intrinsics.string;
+
+import java.util.Random;
+
+import jdk.test.lib.Utils;
+
+public class TestStringHashCode {
+
+    private static final int ITERATIONS = 20_000;
+    private static final int MAX_LENGTH = 300;
+
+    static int expectedHashCode(char[] chars) {
+        int h = 0;
+        for (char c : chars) {
+            h = 31 * h + c;
+        }
+        return h;
+    }
+
+    // Use a fresh String each time, so that the cached hash is not used
+    static int hashCode(char[] chars) {
+        return new String(chars).hashCode();
+    }
+
+    static char[] randomChars(Random random, int length, boolean latin1) {
+        char[] chars = new char[length];
+        for (int i = 0; i < length; i++) {
+            // Cover the full unsigned range, so that sign extension bugs show up
+            chars[i] = (char)(latin1 ? random.nextInt(0x100) : random.nextInt(0x10000));
+        }
+        if (!latin1 && length > 0) {
+            // Make sure the string can't be compressed
+            chars[random.nextInt(length)] = '\uffff';
+        }
+        return chars;
+    }
+
+    static void check(char[] chars, boolean latin1) {
+        int expected = expectedHashCode(chars);
+        int actual = hashCode(chars);
+        if (actual != expected) {
+            throw new RuntimeException((latin1 ? "Latin-1" : "UTF-16") + " string of length " + chars.length +
+                                       ": hashCode() = " + actual + ", expected " + expected);
+        }
+    }
+
+    public static void main(String[] args) {
+        Random random = Utils.getRandomInstance();
+
+        char[][] latin1 = new char[MAX_LENGTH + 1][];
+        char[][] utf16 = new char[MAX_LENGTH + 1][];
+        for (int length = 0; length <= MAX_LENGTH; length++) {
+            latin1[length] = randomChars(random, length, true);
+            utf16[length] = randomChars(random, length, false);
+        }
+
+        // Run enough iterations to get hashCode() compiled when a JIT is used
+        for (int i = 0; i < ITERATIONS; i++) {
+            int length = i % (MAX_LENGTH + 1);
+            check(latin1[length], true);
+            check(utf16[length], false);
+        }
+    }
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestEvacuationFailureVerifyBOT
+ * @summary Verify the block offset table of regions that failed evacuation
+ *          after their self-forwarding pointers have been removed.
+ * @requires vm.gc.G1
+ * @requires vm.debug
+ * @run main/othervm -XX:+UseG1GC -Xmx32M -Xmn16M -XX:ParallelGCThreads=4
+ *                   -XX:+G1EvacuationFailureALot
+ *                   -XX:G1EvacuationFailureALotCount=100
+ *                   -XX:G1EvacuationFailureALotInterval=1
+ *                   -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:+VerifyBeforeGC -XX:+VerifyAfterGC
+ *                   gc.g1.TestEvacuationFailureVerifyBOT
+ */
+
+import java.util.ArrayList;
+import java.util.Random;
+
+public class TestEvacuationFailureVerifyBOT {
+
+    public static void main(String[] args) {
+        Random random = new Random(42);
+        ArrayList<Object> live = new ArrayList<>();
+        // Keep a mix of small objects and arrays spanning several cards
+        // alive, so regions that fail evacuation need many BOT entries.
+        for (int i = 0; i < 200_000; i++) {
+            Object o = (i % 4 == 0) ? new byte[random.nextInt(4096)] : new Object[2];
+            if (random.nextInt(8) == 0) {
+                live.add(o);
+            }
+            if (live.size() > 20_000) {
+                live.subList(0, 10_000).clear();
+            }
+        }
+        System.gc();
+        System.out.println(live.size());
+    }
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestOldRegionObjectAllocation
+ * @summary G1: objects just over half a region in size are allocated into old
+ *              regions instead of humongous regions when G1OldRegionObjectMaxPercent
+ *              allows it, keep their contents and references across collections,
+ *              and pass heap verification.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @run driver gc.g1.TestOldRegionObjectAllocation
+ */
+
+import java.util.ArrayList;
+import java.util.Arrays;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestOldRegionObjectAllocation {
+    private static final int heapRegionSize = 1; // MB
+
+    public static void main(String[] args) throws Exception {
+        runTest();
+        // System.gc() starts concurrent cycles, so VerifyDuringGC verifies
+        // the heap in the Remark and Cleanup pauses too.
+        runTest("-XX:+ExplicitGCInvokesConcurrent");
+    }
+
+    private static void runTest(String... extraOptions) throws Exception {
+        ArrayList<String> options = new ArrayList<>(Arrays.asList(
+            "-XX:+UseG1GC",
+            "-Xms128m",
+            "-Xmx128m",
+            "-XX:G1HeapRegionSize=" + heapRegionSize + "m",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:G1OldRegionObjectMaxPercent=75",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+VerifyBeforeGC",
+            "-XX:+VerifyDuringGC",
+            "-XX:+VerifyAfterGC",
+            "-Xlog:gc+heap=info"));
+        options.addAll(Arrays.asList(extraOptions));
+        options.add(OldRegionObjectAllocator.class.getName());
+
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(options);
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        // None of the arrays is large enough to need a humongous region.
+        output.shouldMatch("Humongous regions: 0->0");
+        output.shouldNotMatch("Humongous regions: [0-9]*->[1-9]");
+    }
+
+    static class OldRegionObjectAllocator {
+        // About 60% of a region; the 128M heap uses compressed oops.
+        private static final int LONG_ARRAY_LENGTH = 80 * 1024;
+        private static final int REF_ARRAY_LENGTH = 150 * 1024;
+
+        private static Object garbage;
+
+        private static void checkLongArrays(ArrayList<long[]> live) {
+            for (int i = 0; i < live.size(); i++) {
+                long[] array = live.get(i);
+                for (int j = 0; j < array.length; j++) {
+                    if (array[j] != i * 8) {
+                        throw new RuntimeException("Array " + i + " has been corrupted at index " + j +
+                                                   ": " + array[j]);
+                    }
+                }
+            }
+        }
+
+        private static void checkRefArrays(ArrayList<Object[]> refArrays, int round) {
+            for (int i = 0; i < refArrays.size(); i++) {
+                Object[] refs = refArrays.get(i);
+                for (int j = 0; j < refs.length; j += 64) {
+                    String expected = round + ":" + i + ":" + j;
+                    if (!expected.equals(refs[j])) {
+                        throw new RuntimeException("Reference array " + i + " has been corrupted at index " + j +
+                                                   ": " + refs[j] + ", expected " + expected);
+                    }
+                }
+            }
+        }
+
+        public static void main(String [] args) {
+            ArrayList<long[]> live = new ArrayList<>();
+            for (int i = 0; i < 512; i++) {
+                long[] array = new long[LONG_ARRAY_LENGTH];
+                Arrays.fill(array, i);
+                if (i % 8 == 0) {
+                    live.add(array);
+                }
+            }
+            System.gc();
+            checkLongArrays(live);
+
+            // Old-to-young references from the old region objects have to be
+            // found through the remembered sets, by refinement or in the pause.
+            ArrayList<Object[]> refArrays = new ArrayList<>();
+            for (int i = 0; i < 16; i++) {
+                refArrays.add(new Object[REF_ARRAY_LENGTH]);
+            }
+            for (int round = 0; round < 8; round++) {
+                for (int i = 0; i < refArrays.size(); i++) {
+                    Object[] refs = refArrays.get(i);
+                    for (int j = 0; j < refs.length; j += 64) {
+                        refs[j] = round + ":" + i + ":" + j;
+                    }
+                }
+                // Enough young garbage for a few young collections.
+                for (int k = 0; k < 4 * 1024; k++) {
+                    garbage = new byte[8 * 1024];
+                }
+                checkRefArrays(refArrays, round);
+                if (round % 4 == 3) {
+                    System.gc();
+                    checkRefArrays(refArrays, round);
+                }
+            }
+            checkLongArrays(live);
+        }
+    }
+}
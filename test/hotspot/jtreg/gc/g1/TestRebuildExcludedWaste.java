@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestRebuildExcludedWaste
+ * @summary Old regions left out of the remembered set rebuild at Remark count
+ *          against G1HeapWastePercent when the candidates are pruned.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @build sun.hotspot.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller sun.hotspot.WhiteBox
+ * @run driver gc.g1.TestRebuildExcludedWaste
+ */
+
+import java.util.ArrayList;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import sun.hotspot.WhiteBox;
+
+public class TestRebuildExcludedWaste {
+    private static final long HEAP_SIZE = 64 * 1024 * 1024;
+    private static final int HEAP_WASTE_PERCENT = 10;
+
+    private static final Pattern EXCLUDED =
+        Pattern.compile("Remembered set rebuild live threshold [0-9]+B, excluded ([0-9]+)B reclaimable");
+    private static final Pattern PRUNED =
+        Pattern.compile("Pruned [0-9]+ regions out of [0-9]+, leaving ([0-9]+) bytes waste \\(allowed ([0-9]+), ([0-9]+) excluded from rebuild\\)");
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-Xbootclasspath/a:.",
+            "-XX:+UseG1GC",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-Xms" + HEAP_SIZE,
+            "-Xmx" + HEAP_SIZE,
+            "-XX:G1HeapRegionSize=1m",
+            // A single worker copies and compacts the objects in the order
+            // of the list, so that every old region keeps a live object.
+            "-XX:ParallelGCThreads=1",
+            "-XX:ConcGCThreads=1",
+            // Only the concurrent cycle started by the test may run.
+            "-XX:-G1UseAdaptiveIHOP",
+            "-XX:InitiatingHeapOccupancyPercent=100",
+            "-XX:G1MixedGCLiveThresholdPercent=100",
+            "-XX:G1HeapWastePercent=" + HEAP_WASTE_PERCENT,
+            "-Xlog:gc+remset+tracking=debug,gc+ergo+cset=debug",
+            GCTest.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+
+        long allowedWaste = HEAP_SIZE * HEAP_WASTE_PERCENT / 100;
+
+        Matcher excludedMatcher = EXCLUDED.matcher(output.getStdout());
+        Asserts.assertTrue(excludedMatcher.find(), "No Remark rebuild threshold in output");
+        long excluded = Long.parseLong(excludedMatcher.group(1));
+        Asserts.assertLTE(excluded, allowedWaste / 2, "Remark excluded more than half of the allowed waste");
+
+        // Far more reclaimable space is left in the candidates than Remark
+        // may exclude, so there are always candidates to prune.
+        Matcher prunedMatcher = PRUNED.matcher(output.getStdout());
+        Asserts.assertTrue(prunedMatcher.find(), "No candidate pruning in output");
+        long pruned = Long.parseLong(prunedMatcher.group(1));
+        long pruneAllowed = Long.parseLong(prunedMatcher.group(2));
+        Asserts.assertEquals(Long.parseLong(prunedMatcher.group(3)), excluded,
+                             "Pruning did not account for the regions excluded at Remark");
+        Asserts.assertEquals(pruneAllowed, allowedWaste - excluded,
+                             "Pruning budget not reduced by the excluded waste");
+        Asserts.assertLTE(excluded + pruned, allowedWaste,
+                          "Total waste exceeds G1HeapWastePercent");
+    }
+
+    public static class GCTest {
+        private static final int OBJECTS_PER_REGION = 16;
+        private static final int REGIONS = 32;
+
+        public static void main(String[] args) throws Exception {
+            WhiteBox wb = WhiteBox.getWhiteBox();
+            int objectSize = wb.g1RegionSize() / OBJECTS_PER_REGION - 64;
+
+            ArrayList<byte[]> live = new ArrayList<>();
+            for (int i = 0; i < REGIONS * OBJECTS_PER_REGION; i++) {
+                live.add(new byte[objectSize]);
+            }
+            // Move everything into densely packed old regions.
+            wb.fullGC();
+
+            // Leave the old regions with increasing occupancy, so that the
+            // most occupied ones can be excluded from the rebuild. Each
+            // region holds OBJECTS_PER_REGION consecutive objects, so it
+            // keeps at least the first object of some group.
+            for (int r = 0; r < REGIONS; r++) {
+                int keep = 1 + r * (OBJECTS_PER_REGION - 1) / REGIONS;
+                for (int i = keep; i < OBJECTS_PER_REGION; i++) {
+                    live.set(r * OBJECTS_PER_REGION + i, null);
+                }
+            }
+
+            if (!wb.g1StartConcMarkCycle()) {
+                throw new RuntimeException("Could not start a concurrent cycle");
+            }
+            while (wb.g1InConcurrentMark()) {
+                Thread.sleep(100);
+            }
+            System.out.println(live.size());
+        }
+    }
+}
@@ -28,19 +28,15 @@ import jdk.test.lib.Platform;
 import jdk.test.lib.Utils;
 import jdk.test.lib.process.ProcessTools;
 import jdk.test.lib.process.OutputAnalyzer;
-import jtreg.SkippedException;
 
 import java.io.IOException;
 import java.lang.management.ManagementFactory;
 import java.lang.management.MemoryUsage;
-import java.text.DecimalFormat;
-import java.text.DecimalFormatSymbols;
 import java.util.ArrayList;
 import java.util.Collections;
 import java.util.LinkedList;
 import java.util.List;
 import java.util.Random;
-import jdk.internal.misc.Unsafe; // for ADDRESS_SIZE
 import sun.hotspot.WhiteBox;
 
 public class TestShrinkAuxiliaryData {
@@ -62,27 +58,10 @@ public class TestShrinkAuxiliaryData {
         "-Xbootclasspath/a:.",
     };
 
-    private final int hotCardTableSize;
-
-    protected TestShrinkAuxiliaryData(int hotCardTableSize) {
-        this.hotCardTableSize = hotCardTableSize;
-    }
-
     protected void test() throws Exception {
         ArrayList<String> vmOpts = new ArrayList<>();
         Collections.addAll(vmOpts, initialOpts);
 
-        int maxCacheSize = Math.max(0, Math.min(31, getMaxCacheSize()));
-        if (maxCacheSize < hotCardTableSize) {
-            throw new SkippedException(String.format(
-                    "Skiping test for %d cache size due max cache size %d",
-                    hotCardTableSize, maxCacheSize));
-        }
-
-        printTestInfo(maxCacheSize);
-
-        vmOpts.add("-XX:G1ConcRSLogCacheSize=" + hotCardTableSize);
-
         // for 32 bits ObjectAlignmentInBytes is not a option
         if (Platform.is32bit()) {
             ArrayList<String> vmOptsWithoutAlign = new ArrayList<>(vmOpts);
@@ -110,47 +89,6 @@ public class TestShrinkAuxiliaryData {
         output.shouldHaveExitValue(0);
     }
 
-    private void printTestInfo(int maxCacheSize) {
-
-        DecimalFormat grouped = new DecimalFormat("000,000");
-        DecimalFormatSymbols formatSymbols = grouped.getDecimalFormatSymbols();
-        formatSymbols.setGroupingSeparator(' ');
-        grouped.setDecimalFormatSymbols(formatSymbols);
-
-        System.out.format(
-                "Test will use %s bytes of memory of %s available%n"
-                + "Available memory is %s with %d bytes pointer size - can save %s pointers%n"
-                + "Max cache size: 2^%d = %s elements%n",
-                grouped.format(ShrinkAuxiliaryDataTest.getMemoryUsedByTest()),
-                grouped.format(Runtime.getRuntime().maxMemory()),
-                grouped.format(Runtime.getRuntime().maxMemory()
-                        - ShrinkAuxiliaryDataTest.getMemoryUsedByTest()),
-                Unsafe.ADDRESS_SIZE,
-                grouped.format((Runtime.getRuntime().freeMemory()
-                        - ShrinkAuxiliaryDataTest.getMemoryUsedByTest())
-                        / Unsafe.ADDRESS_SIZE),
-                maxCacheSize,
-                grouped.format((int) Math.pow(2, maxCacheSize))
-        );
-    }
-
-    /**
-     * Detects maximum possible size of G1ConcRSLogCacheSize available for
-     * current process based on maximum available process memory size
-     *
-     * @return power of two
-     */
-    private static int getMaxCacheSize() {
-        long availableMemory = Runtime.getRuntime().freeMemory()
-                - ShrinkAuxiliaryDataTest.getMemoryUsedByTest() - 1l;
-        if (availableMemory <= 0) {
-            return 0;
-        }
-
-        long availablePointersCount = availableMemory / Unsafe.ADDRESS_SIZE;
-        return (63 - (int) Long.numberOfLeadingZeros(availablePointersCount));
-    }
-
     static class ShrinkAuxiliaryDataTest {
 
         public static void main(String[] args) throws Exception {
@@ -167,7 +105,6 @@ public class TestShrinkAuxiliaryData {
         /**
          * Checks is this environment suitable to run this test
          * - memory is enough to decommit (page size is not big)
-         * - RSet cache size is not too big
          *
          * @return true if test could run, false if test should be skipped
          */
@@ -324,10 +261,6 @@ public class TestShrinkAuxiliaryData {
             System.gc();
         }
 
-        static long getMemoryUsedByTest() {
-            return REGIONS_TO_ALLOCATE * REGION_SIZE;
-        }
-
         private static final int REGIONS_TO_ALLOCATE = 100;
         private static final int NUM_OBJECTS_PER_REGION = 10;
         private static final int NUM_LINKS = 20; // how many links create for each object
@@ -28,7 +28,7 @@ package gc.g1;
  * @key randomness
  * @bug 8038423 8061715
  * @summary Checks that decommitment occurs for JVM with different
- * G1ConcRSLogCacheSize and ObjectAlignmentInBytes options values
+ * ObjectAlignmentInBytes options values
  * @requires vm.gc.G1
  * @library /test/lib
  * @library /
@@ -41,6 +41,6 @@ package gc.g1;
 public class TestShrinkAuxiliaryData00 {
 
     public static void main(String[] args) throws Exception {
-        new TestShrinkAuxiliaryData(0).test();
+        new TestShrinkAuxiliaryData().test();
     }
 }
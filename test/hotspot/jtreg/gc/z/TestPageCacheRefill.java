@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.z;
+
+/*
+ * @test TestPageCacheRefill
+ * @requires vm.gc.Z
+ * @summary Smoke test medium page refill of the ZGC page cache
+ * @library /test/lib
+ * @run driver gc.z.TestPageCacheRefill
+ */
+
+import java.util.ArrayList;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestPageCacheRefill {
+    private static OutputAnalyzer run(String... extraArgs) throws Exception {
+        ArrayList<String> args = new ArrayList<>();
+        args.add("-XX:+UseZGC");
+        args.add("-XX:+UnlockExperimentalVMOptions");
+        args.add("-XX:+ZPageCacheRefill");
+        args.add("-Xlog:gc+heap=debug:stdout:uptime");
+        args.add("-Xmx512M");
+        for (String arg : extraArgs) {
+            args.add(arg);
+        }
+        args.add(Test.class.getName());
+
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(args);
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    private static final Pattern EVENT =
+        Pattern.compile("^\\[([0-9]+)[.,]([0-9]+)s\\] (Uncommitted|Page Cache Refilled)", Pattern.MULTILINE);
+
+    // The uncommit delay is in whole seconds and starts when the pages are
+    // flushed, shortly before the uncommit is logged. With a delay of two
+    // seconds, refill is refused for at least a second after the log line.
+    private static final int UNCOMMIT_DELAY_SECONDS = 2;
+    private static final long REFILL_FREE_MILLIS = 500;
+
+    private static void checkNoRefillAfterUncommit(OutputAnalyzer output) {
+        long lastUncommit = -1;
+        int uncommits = 0;
+        Matcher m = EVENT.matcher(output.getStdout());
+        while (m.find()) {
+            long millis = Long.parseLong(m.group(1)) * 1000 + Long.parseLong((m.group(2) + "00").substring(0, 3));
+            if (m.group(3).equals("Uncommitted")) {
+                lastUncommit = millis;
+                uncommits++;
+            } else if (lastUncommit >= 0 && millis - lastUncommit < REFILL_FREE_MILLIS) {
+                throw new RuntimeException("Page cache refilled " + (millis - lastUncommit) +
+                                           "ms after an uncommit");
+            }
+        }
+        if (uncommits == 0) {
+            throw new RuntimeException("No uncommit in output");
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        // Refill after medium page allocations
+        run("-Xms512M").shouldContain("Page Cache Refilled");
+
+        // Refill interleaved with uncommit; no refill right after uncommit
+        checkNoRefillAfterUncommit(run("-Xms128M", "-XX:ZUncommitDelay=" + UNCOMMIT_DELAY_SECONDS));
+    }
+
+    public static class Test {
+        // Large enough to be allocated in medium pages
+        private static final int OBJECT_SIZE = 1 * 1024 * 1024;
+
+        public static void main(String[] args) throws Exception {
+            for (int round = 0; round < 3; round++) {
+                ArrayList<byte[]> list = new ArrayList<>();
+                for (int i = 0; i < 128; i++) {
+                    list.add(new byte[OBJECT_SIZE]);
+                }
+                list = null;
+
+                // Wait for the unused memory to pass the uncommit delay
+                System.gc();
+                Thread.sleep(UNCOMMIT_DELAY_SECONDS * 1000 + 500);
+            }
+        }
+    }
+}
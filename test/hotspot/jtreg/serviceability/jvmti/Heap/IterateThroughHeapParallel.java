@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Tag, retag and untag objects from the callbacks of the
+ *          IterateThroughHeapParallel extension function, including biased
+ *          and locked objects, and check that several workers ran them.
+ * @requires vm.jvmti & vm.gc.G1
+ * @run main/othervm/native -agentlib:IterateThroughHeapParallel
+ *                          -XX:+UseG1GC -XX:ParallelGCThreads=4 -XX:G1HeapRegionSize=1m
+ *                          IterateThroughHeapParallel
+ * @run main/othervm/native -agentlib:IterateThroughHeapParallel
+ *                          -XX:+UseG1GC -XX:ParallelGCThreads=4 -XX:G1HeapRegionSize=1m
+ *                          -XX:+UseBiasedLocking -XX:BiasedLockingStartupDelay=0
+ *                          IterateThroughHeapParallel
+ */
+
+import java.util.concurrent.CountDownLatch;
+
+public class IterateThroughHeapParallel {
+
+    static class Payload {
+        int value;
+    }
+
+    // Enough objects to span many heap regions, so that every worker
+    // of the iteration finds some.
+    private static final int COUNT = 1_000_000;
+    private static final long TAG = 42;
+    private static final long NEW_TAG = 43;
+
+    // Sets the tag of every instance of klass to tag from the heap callback.
+    private static native boolean tagInstances(Class<?> klass, long tag);
+    // Returns the number of objects tagged with tag, or -1 on error.
+    private static native int countTagged(long tag);
+    private static native long getTag(Object o);
+    // Returns the number of threads that ran callbacks in the last iteration.
+    private static native int callbackThreads();
+
+    private static void tagAndCheck(Payload[] payloads, long tag) {
+        if (!tagInstances(Payload.class, tag)) {
+            throw new RuntimeException("Iteration with tag " + tag + " failed");
+        }
+        int threads = callbackThreads();
+        System.out.println("Tag " + tag + ": callbacks ran on " + threads + " threads");
+        if (threads < 2) {
+            throw new RuntimeException("Expected callbacks from several threads, got " + threads);
+        }
+        if (tag != 0) {
+            int tagged = countTagged(tag);
+            if (tagged != COUNT) {
+                throw new RuntimeException("Expected " + COUNT + " objects tagged " + tag + ", got " + tagged);
+            }
+        }
+        for (int i = 0; i < COUNT; i++) {
+            long actual = getTag(payloads[i]);
+            if (actual != tag) {
+                throw new RuntimeException("Object " + i + " has tag " + actual + ", expected " + tag);
+            }
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        Payload[] payloads = new Payload[COUNT];
+        for (int i = 0; i < COUNT; i++) {
+            payloads[i] = new Payload();
+        }
+
+        // Bias some objects to this thread and hash some others.
+        for (int i = 0; i < COUNT; i += 3) {
+            synchronized (payloads[i]) {
+                payloads[i].value = i;
+            }
+        }
+        for (int i = 1; i < COUNT; i += 7) {
+            payloads[i].hashCode();
+        }
+
+        // Keep one object locked by another thread during the iteration.
+        Payload locked = payloads[2];
+        CountDownLatch isLocked = new CountDownLatch(1);
+        CountDownLatch done = new CountDownLatch(1);
+        Thread holder = new Thread(() -> {
+            synchronized (locked) {
+                isLocked.countDown();
+                try {
+                    done.await();
+                } catch (InterruptedException e) {
+                    throw new RuntimeException(e);
+                }
+            }
+        });
+        holder.start();
+        isLocked.await();
+
+        try {
+            // New tags, then changed tags, then cleared tags.
+            tagAndCheck(payloads, TAG);
+            tagAndCheck(payloads, NEW_TAG);
+            if (countTagged(TAG) != 0) {
+                throw new RuntimeException("Objects still tagged " + TAG);
+            }
+            tagAndCheck(payloads, 0);
+            if (countTagged(NEW_TAG) != 0) {
+                throw new RuntimeException("Objects still tagged " + NEW_TAG);
+            }
+        } finally {
+            done.countDown();
+            holder.join();
+        }
+    }
+}
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+#include "jvmti.h"
+#include "jni.h"
+
+extern "C" {
+
+static const char* const EXT_FUNCTION_ID = "com.sun.hotspot.functions.IterateThroughHeapParallel";
+
+static jvmtiEnv *jvmti;
+static jvmtiExtensionFunction iterate_through_heap_parallel;
+
+static void ShowErrorMessage(jvmtiError errCode, const char *message) {
+  char *errMsg;
+  jvmtiError result;
+
+  result = jvmti->GetErrorName(errCode, &errMsg);
+  if (result == JVMTI_ERROR_NONE) {
+    fprintf(stderr, "%s: %s (%d)\n", message, errMsg, errCode);
+    jvmti->Deallocate((unsigned char *)errMsg);
+  } else {
+    fprintf(stderr, "%s (%d)\n", message, errCode);
+  }
+}
+
+// Iterations are numbered so that each thread counts itself once per
+// iteration in callback_threads.
+static int iteration = 0;
+static thread_local int thread_iteration = 0;
+static std::atomic<int> callback_threads(0);
+
+// Waits a while for a second thread to deliver callbacks, so that a worker
+// that starts early does not walk the whole heap alone.
+static void await_other_thread() {
+  std::chrono::steady_clock::time_point deadline =
+    std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (callback_threads.load() < 2 && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::yield();
+  }
+}
+
+// May be called from several threads at once; every call tags the object
+// with the same value, so no synchronization is needed.
+static jint JNICALL
+heap_iteration_callback(jlong class_tag, jlong size, jlong* tag_ptr, jint length, void* user_data) {
+  if (thread_iteration != iteration) {
+    thread_iteration = iteration;
+    callback_threads++;
+    await_other_thread();
+  }
+  *tag_ptr = *(jlong*)user_data;
+  return 0;
+}
+
+static jvmtiExtensionFunction find_extension_function(const char* id) {
+  jint count = 0;
+  jvmtiExtensionFunctionInfo* functions = NULL;
+  jvmtiExtensionFunction result = NULL;
+
+  jvmtiError err = jvmti->GetExtensionFunctions(&count, &functions);
+  if (err != JVMTI_ERROR_NONE) {
+    ShowErrorMessage(err, "GetExtensionFunctions failed");
+    return NULL;
+  }
+  for (jint i = 0; i < count; i++) {
+    if (strcmp(functions[i].id, id) == 0) {
+      result = functions[i].func;
+    }
+    jvmti->Deallocate((unsigned char*)functions[i].id);
+    jvmti->Deallocate((unsigned char*)functions[i].short_description);
+    for (jint j = 0; j < functions[i].param_count; j++) {
+      jvmti->Deallocate((unsigned char*)functions[i].params[j].name);
+    }
+    jvmti->Deallocate((unsigned char*)functions[i].params);
+    jvmti->Deallocate((unsigned char*)functions[i].errors);
+  }
+  jvmti->Deallocate((unsigned char*)functions);
+  return result;
+}
+
+JNIEXPORT jint JNICALL
+Agent_OnLoad(JavaVM *jvm, char *options, void *reserved) {
+  jvmtiCapabilities caps;
+
+  jint res = jvm->GetEnv((void **) &jvmti, JVMTI_VERSION_9);
+  if (res != JNI_OK || jvmti == NULL) {
+    fprintf(stderr, "Error: wrong result of a valid call to GetEnv!\n");
+    return JNI_ERR;
+  }
+
+  memset(&caps, 0, sizeof(caps));
+  caps.can_tag_objects = 1;
+  jvmtiError err = jvmti->AddCapabilities(&caps);
+  if (err != JVMTI_ERROR_NONE) {
+    ShowErrorMessage(err, "AddCapabilities failed");
+    return JNI_ERR;
+  }
+
+  iterate_through_heap_parallel = find_extension_function(EXT_FUNCTION_ID);
+  if (iterate_through_heap_parallel == NULL) {
+    fprintf(stderr, "Error: extension function %s not found\n", EXT_FUNCTION_ID);
+    return JNI_ERR;
+  }
+  return JNI_OK;
+}
+
+JNIEXPORT jboolean JNICALL
+Java_IterateThroughHeapParallel_tagInstances(JNIEnv *env, jclass cls, jclass klass, jlong tag) {
+  jvmtiHeapCallbacks callbacks;
+  memset(&callbacks, 0, sizeof(callbacks));
+  callbacks.heap_iteration_callback = &heap_iteration_callback;
+
+  iteration++;
+  callback_threads = 0;
+  jvmtiError err = iterate_through_heap_parallel(jvmti, (jint)0, klass, &callbacks, &tag);
+  if (err != JVMTI_ERROR_NONE) {
+    ShowErrorMessage(err, "IterateThroughHeapParallel failed");
+    return JNI_FALSE;
+  }
+  return JNI_TRUE;
+}
+
+JNIEXPORT jint JNICALL
+Java_IterateThroughHeapParallel_countTagged(JNIEnv *env, jclass cls, jlong tag) {
+  jint count = 0;
+  jvmtiError err = jvmti->GetObjectsWithTags(1, &tag, &count, NULL, NULL);
+  if (err != JVMTI_ERROR_NONE) {
+    ShowErrorMessage(err, "GetObjectsWithTags failed");
+    return -1;
+  }
+  return count;
+}
+
+JNIEXPORT jlong JNICALL
+Java_IterateThroughHeapParallel_getTag(JNIEnv *env, jclass cls, jobject o) {
+  jlong tag = 0;
+  jvmtiError err = jvmti->GetTag(o, &tag);
+  if (err != JVMTI_ERROR_NONE) {
+    ShowErrorMessage(err, "GetTag failed");
+    return -1;
+  }
+  return tag;
+}
+
+JNIEXPORT jint JNICALL
+Java_IterateThroughHeapParallel_callbackThreads(JNIEnv *env, jclass cls) {
+  return callback_threads.load();
+}
+
+}
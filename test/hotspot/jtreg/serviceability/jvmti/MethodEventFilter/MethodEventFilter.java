@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Check that the SetMethodEventFilter extension function restricts
+ *          MethodEntry and MethodExit events to the selected methods.
+ * @requires vm.jvmti
+ * @run main/othervm/native -agentlib:MethodEventFilter MethodEventFilter
+ */
+
+import java.lang.reflect.Method;
+
+public class MethodEventFilter {
+
+    private static final int CALLS = 10;
+
+    // Sets the filter to the given methods, null clears it.
+    private static native void setFilter(Method[] methods);
+    private static native void enableEvents(Method selected, Method other);
+    private static native void disableEvents();
+    private static native int entryCount(boolean selected);
+    private static native int exitCount(boolean selected);
+
+    static int sink;
+
+    static void selected() {
+        sink++;
+    }
+
+    static void other() {
+        sink--;
+    }
+
+    private static void run(Method selected, Method other, Method[] filter) {
+        setFilter(filter);
+        enableEvents(selected, other);
+        for (int i = 0; i < CALLS; i++) {
+            selected();
+            other();
+        }
+        disableEvents();
+    }
+
+    private static void check(String what, int actual, int expected) {
+        if (actual != expected) {
+            throw new RuntimeException(what + ": expected " + expected + " events, got " + actual);
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        Method selected = MethodEventFilter.class.getDeclaredMethod("selected");
+        Method other = MethodEventFilter.class.getDeclaredMethod("other");
+
+        run(selected, other, new Method[] { selected });
+        check("MethodEntry of selected method", entryCount(true), CALLS);
+        check("MethodExit of selected method", exitCount(true), CALLS);
+        check("MethodEntry of filtered method", entryCount(false), 0);
+        check("MethodExit of filtered method", exitCount(false), 0);
+
+        run(selected, other, null);
+        check("MethodEntry without filter", entryCount(false), CALLS);
+        check("MethodExit without filter", exitCount(false), CALLS);
+    }
+}
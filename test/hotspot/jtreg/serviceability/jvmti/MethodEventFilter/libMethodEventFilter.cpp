@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "jvmti.h"
+#include "jni.h"
+
+extern "C" {
+
+static const char* const EXT_FUNCTION_ID = "com.sun.hotspot.functions.SetMethodEventFilter";
+
+static jvmtiEnv *jvmti;
+static jvmtiExtensionFunction set_method_event_filter;
+
+static jmethodID selected_method;
+static jmethodID other_method;
+static int entry_count[2];
+static int exit_count[2];
+
+static void check_error(JNIEnv* env, jvmtiError err, const char* message) {
+  if (err != JVMTI_ERROR_NONE) {
+    char buf[256];
+    snprintf(buf, sizeof(buf), "%s failed with error %d", message, err);
+    env->FatalError(buf);
+  }
+}
+
+// Events are only enabled for the main thread, so the counters need no
+// synchronization.
+static void JNICALL
+MethodEntry(jvmtiEnv* jvmti, JNIEnv* env, jthread thread, jmethodID method) {
+  if (method == selected_method) {
+    entry_count[1]++;
+  } else if (method == other_method) {
+    entry_count[0]++;
+  }
+}
+
+static void JNICALL
+MethodExit(jvmtiEnv* jvmti, JNIEnv* env, jthread thread, jmethodID method,
+           jboolean was_popped_by_exception, jvalue return_value) {
+  if (method == selected_method) {
+    exit_count[1]++;
+  } else if (method == other_method) {
+    exit_count[0]++;
+  }
+}
+
+static jvmtiExtensionFunction find_extension_function(const char* id) {
+  jint count = 0;
+  jvmtiExtensionFunctionInfo* functions = NULL;
+  jvmtiExtensionFunction result = NULL;
+
+  if (jvmti->GetExtensionFunctions(&count, &functions) != JVMTI_ERROR_NONE) {
+    return NULL;
+  }
+  for (jint i = 0; i < count; i++) {
+    if (strcmp(functions[i].id, id) == 0) {
+      result = functions[i].func;
+    }
+    jvmti->Deallocate((unsigned char*)functions[i].id);
+    jvmti->Deallocate((unsigned char*)functions[i].short_description);
+    for (jint j = 0; j < functions[i].param_count; j++) {
+      jvmti->Deallocate((unsigned char*)functions[i].params[j].name);
+    }
+    jvmti->Deallocate((unsigned char*)functions[i].params);
+    jvmti->Deallocate((unsigned char*)functions[i].errors);
+  }
+  jvmti->Deallocate((unsigned char*)functions);
+  return result;
+}
+
+JNIEXPORT jint JNICALL
+Agent_OnLoad(JavaVM *jvm, char *options, void *reserved) {
+  jvmtiCapabilities caps;
+  jvmtiEventCallbacks callbacks;
+
+  jint res = jvm->GetEnv((void **) &jvmti, JVMTI_VERSION_9);
+  if (res != JNI_OK || jvmti == NULL) {
+    fprintf(stderr, "Error: wrong result of a valid call to GetEnv!\n");
+    return JNI_ERR;
+  }
+
+  memset(&caps, 0, sizeof(caps));
+  caps.can_generate_method_entry_events = 1;
+  caps.can_generate_method_exit_events = 1;
+  if (jvmti->AddCapabilities(&caps) != JVMTI_ERROR_NONE) {
+    fprintf(stderr, "Error: AddCapabilities failed\n");
+    return JNI_ERR;
+  }
+
+  memset(&callbacks, 0, sizeof(callbacks));
+  callbacks.MethodEntry = &MethodEntry;
+  callbacks.MethodExit = &MethodExit;
+  if (jvmti->SetEventCallbacks(&callbacks, sizeof(callbacks)) != JVMTI_ERROR_NONE) {
+    fprintf(stderr, "Error: SetEventCallbacks failed\n");
+    return JNI_ERR;
+  }
+
+  set_method_event_filter = find_extension_function(EXT_FUNCTION_ID);
+  if (set_method_event_filter == NULL) {
+    fprintf(stderr, "Error: extension function %s not found\n", EXT_FUNCTION_ID);
+    return JNI_ERR;
+  }
+  // The filter can only be set in the live phase.
+  jvmtiError err = set_method_event_filter(jvmti, (jint)0, (jmethodID*)NULL);
+  if (err != JVMTI_ERROR_WRONG_PHASE) {
+    fprintf(stderr, "Error: SetMethodEventFilter in the OnLoad phase returned %d\n", err);
+    return JNI_ERR;
+  }
+  return JNI_OK;
+}
+
+JNIEXPORT void JNICALL
+Java_MethodEventFilter_setFilter(JNIEnv *env, jclass cls, jobjectArray methods) {
+  jint count = methods == NULL ? 0 : env->GetArrayLength(methods);
+  jmethodID ids[16];
+  if (count > 16) {
+    env->FatalError("too many methods");
+  }
+  for (jint i = 0; i < count; i++) {
+    ids[i] = env->FromReflectedMethod(env->GetObjectArrayElement(methods, i));
+  }
+  check_error(env, set_method_event_filter(jvmti, count, ids), "SetMethodEventFilter");
+}
+
+JNIEXPORT void JNICALL
+Java_MethodEventFilter_enableEvents(JNIEnv *env, jclass cls, jobject selected, jobject other) {
+  selected_method = env->FromReflectedMethod(selected);
+  other_method = env->FromReflectedMethod(other);
+  memset(entry_count, 0, sizeof(entry_count));
+  memset(exit_count, 0, sizeof(exit_count));
+
+  jthread thread;
+  check_error(env, jvmti->GetCurrentThread(&thread), "GetCurrentThread");
+  check_error(env, jvmti->SetEventNotificationMode(JVMTI_ENABLE, JVMTI_EVENT_METHOD_ENTRY, thread),
+              "Enable MethodEntry");
+  check_error(env, jvmti->SetEventNotificationMode(JVMTI_ENABLE, JVMTI_EVENT_METHOD_EXIT, thread),
+              "Enable MethodExit");
+}
+
+JNIEXPORT void JNICALL
+Java_MethodEventFilter_disableEvents(JNIEnv *env, jclass cls) {
+  jthread thread;
+  check_error(env, jvmti->GetCurrentThread(&thread), "GetCurrentThread");
+  check_error(env, jvmti->SetEventNotificationMode(JVMTI_DISABLE, JVMTI_EVENT_METHOD_ENTRY, thread),
+              "Disable MethodEntry");
+  check_error(env, jvmti->SetEventNotificationMode(JVMTI_DISABLE, JVMTI_EVENT_METHOD_EXIT, thread),
+              "Disable MethodExit");
+}
+
+JNIEXPORT jint JNICALL
+Java_MethodEventFilter_entryCount(JNIEnv *env, jclass cls, jboolean selected) {
+  return entry_count[selected ? 1 : 0];
+}
+
+JNIEXPORT jint JNICALL
+Java_MethodEventFilter_exitCount(JNIEnv *env, jclass cls, jboolean selected) {
+  return exit_count[selected ? 1 : 0];
+}
+
+}
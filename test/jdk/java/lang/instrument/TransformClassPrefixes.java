@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary The transformers of an agent with a Transform-Class-Prefixes
+ *          manifest attribute see only loaded classes whose names match
+ *          one of the prefixes, and see all retransformed classes.
+ * @library /test/lib
+ * @modules java.instrument
+ * @build TransformClassPrefixes jdk.test.lib.util.JavaAgentBuilder
+ * @run driver TransformClassPrefixes
+ */
+
+import java.lang.instrument.ClassFileTransformer;
+import java.lang.instrument.Instrumentation;
+import java.security.ProtectionDomain;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.HashSet;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.lib.util.JavaAgentBuilder;
+
+public class TransformClassPrefixes {
+
+    private static final String AGENT_JAR = "TransformClassPrefixes.jar";
+    private static final String[] PREFIXES = { "TCPMatchedA", "TCPMatchedB" };
+
+    private static Instrumentation instrumentation;
+    private static final Set<String> transformed = Collections.synchronizedSet(new HashSet<>());
+
+    static class Recorder implements ClassFileTransformer {
+        @Override
+        public byte[] transform(ClassLoader loader, String className, Class<?> classBeingRedefined,
+                                ProtectionDomain protectionDomain, byte[] classfileBuffer) {
+            if (className != null) {
+                transformed.add(className);
+            }
+            return null;
+        }
+    }
+
+    public static void premain(String args, Instrumentation inst) {
+        instrumentation = inst;
+        inst.addTransformer(new Recorder(), true /* canRetransform */);
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (args.length == 0) {
+            JavaAgentBuilder.build(TransformClassPrefixes.class.getName(), AGENT_JAR,
+                                   Map.of("Transform-Class-Prefixes", String.join(" ", PREFIXES)));
+            ProcessTools.executeTestJava("-javaagent:" + AGENT_JAR,
+                                         TransformClassPrefixes.class.getName(), "test")
+                        .outputTo(System.out)
+                        .errorTo(System.out)
+                        .shouldHaveExitValue(0);
+            return;
+        }
+
+        new TCPMatchedA();
+        new TCPMatchedB();
+        new TCPOther();
+
+        List<String> seen;
+        synchronized (transformed) {
+            seen = new ArrayList<>(transformed);
+        }
+        System.out.println("Transformed at load: " + seen);
+        for (String name : List.of("TCPMatchedA", "TCPMatchedB")) {
+            if (!seen.contains(name)) {
+                throw new RuntimeException(name + " was not transformed at load");
+            }
+        }
+        for (String name : seen) {
+            if (!name.startsWith(PREFIXES[0]) && !name.startsWith(PREFIXES[1])) {
+                throw new RuntimeException(name + " matches no prefix but was transformed at load");
+            }
+        }
+
+        // Retransformation is requested explicitly, so it is not filtered.
+        instrumentation.retransformClasses(TCPOther.class);
+        if (!transformed.contains("TCPOther")) {
+            throw new RuntimeException("TCPOther was not transformed on retransformation");
+        }
+    }
+}
+
+class TCPMatchedA {
+}
+
+class TCPMatchedB {
+}
+
+class TCPOther {
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package jdk.jfr.api.consumer;
+
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Random;
+
+import jdk.jfr.Event;
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.jfr.consumer.RecordedFrame;
+import jdk.jfr.consumer.RecordedStackTrace;
+import jdk.test.lib.Asserts;
+import jdk.test.lib.Utils;
+import jdk.test.lib.jfr.Events;
+
+/**
+ * @test
+ * @summary Stack traces recorded with frames reused from the previous walk
+ *          of the same thread must match the actual stack.
+ * @key jfr randomness
+ * @requires vm.hasJFR
+ * @library /test/lib
+ * @run main/othervm -XX:FlightRecorderOptions:stackdepth=512 jdk.jfr.api.consumer.TestStackWalkCache
+ * @run main/othervm -Xint -XX:FlightRecorderOptions:stackdepth=512 jdk.jfr.api.consumer.TestStackWalkCache
+ * @run main/othervm -Xcomp -XX:FlightRecorderOptions:stackdepth=512 jdk.jfr.api.consumer.TestStackWalkCache
+ */
+public class TestStackWalkCache {
+
+    private static final int DEPTH = 60;
+    private static final int ROUNDS = 300;
+    private static final int EVENTS_PER_ROUND = 4;
+
+    static class StackEvent extends Event {
+        int id;
+    }
+
+    // Expected frames below leaf(), by event id
+    static final Map<Integer, List<String>> expected = new HashMap<>();
+
+    static class Worker extends Thread {
+        private final Random random;
+
+        Worker(Random random) {
+            this.random = random;
+        }
+
+        @Override
+        public void run() {
+            for (int round = 0; round < ROUNDS; round++) {
+                // Mostly the same bottom of the stack, so that walks can reuse
+                // frames, but sometimes a different path at the same depth.
+                long path = (round % 3 == 0) ? random.nextLong() : 0x5555555555555555L;
+                a(DEPTH, path, round);
+            }
+        }
+    }
+
+    static void a(int depth, long path, int round) {
+        next(depth - 1, path, round);
+    }
+
+    static void b(int depth, long path, int round) {
+        next(depth - 1, path, round);
+    }
+
+    static void next(int depth, long path, int round) {
+        if (depth == 0) {
+            leaf(round);
+        } else if (((path >>> (depth & 63)) & 1) == 0) {
+            a(depth, path, round);
+        } else {
+            b(depth, path, round);
+        }
+    }
+
+    static void leaf(int round) {
+        for (int i = 0; i < EVENTS_PER_ROUND; i++) {
+            int id = round * EVENTS_PER_ROUND + i;
+            StackTraceElement[] stack = new Throwable().getStackTrace();
+            expected.put(id, callers(stack));
+
+            StackEvent event = new StackEvent();
+            event.id = id;
+            event.commit();
+        }
+    }
+
+    private static String describe(String method, int line) {
+        return method + ":" + line;
+    }
+
+    // Frames below leaf(), innermost first
+    private static List<String> callers(StackTraceElement[] stack) {
+        List<String> result = new ArrayList<>();
+        boolean below = false;
+        for (StackTraceElement e : stack) {
+            if (below) {
+                result.add(describe(e.getClassName() + "." + e.getMethodName(), e.getLineNumber()));
+            } else if (e.getMethodName().equals("leaf")) {
+                below = true;
+            }
+        }
+        return result;
+    }
+
+    private static List<String> callers(RecordedStackTrace stack) {
+        List<String> result = new ArrayList<>();
+        boolean below = false;
+        for (RecordedFrame f : stack.getFrames()) {
+            if (!f.isJavaFrame()) {
+                continue;
+            }
+            String method = f.getMethod().getType().getName() + "." + f.getMethod().getName();
+            if (below) {
+                result.add(describe(method, f.getLineNumber()));
+            } else if (f.getMethod().getName().equals("leaf")) {
+                below = true;
+            }
+        }
+        return result;
+    }
+
+    public static void main(String[] args) throws Throwable {
+        try (Recording recording = new Recording()) {
+            recording.enable(StackEvent.class).withStackTrace();
+            recording.start();
+
+            Worker worker = new Worker(Utils.getRandomInstance());
+            worker.start();
+            worker.join();
+
+            recording.stop();
+
+            List<RecordedEvent> events = Events.fromRecording(recording);
+            Asserts.assertEquals(events.size(), ROUNDS * EVENTS_PER_ROUND, "Wrong number of events");
+            for (RecordedEvent event : events) {
+                int id = event.getInt("id");
+                RecordedStackTrace stack = event.getStackTrace();
+                Asserts.assertNotNull(stack, "No stack trace for event " + id);
+                Asserts.assertFalse(stack.isTruncated(), "Truncated stack trace for event " + id);
+                Asserts.assertEquals(callers(stack), expected.get(id), "Wrong stack trace for event " + id);
+            }
+        }
+    }
+}